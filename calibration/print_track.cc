@@ -0,0 +1,43 @@
+// compile with
+// g++ -std=c++2a -I../include -o print_track print_track.cc
+#include <cstdio>
+
+#include "common/track_data.h"
+
+static void print_edge(const track_node track[],
+                       const track_node& src,
+                       const track_edge& e) {
+    printf("EDGE src=%s dest=%s dist=%d\n", src.name, track[e.dest].name,
+           e.dist);
+}
+
+// The reverse of the edge src->dest is the edge from dest's reverse to src's
+// reverse.
+static void print_reverse_edge(const track_node track[],
+                               const track_node& src,
+                               const track_edge& e) {
+    const track_node& rev_src = track[track[e.dest].reverse];
+    for (const track_edge& rev : rev_src.edge) {
+        if (&track[rev.dest] == &track[src.reverse]) {
+            print_edge(track, rev_src, rev);
+            return;
+        }
+    }
+}
+
+int main() {
+    // change to TRACKB if you want track b
+    const track_node* track = TrackData::TRACKA;
+    for (size_t i = 0; i < TRACK_MAX; i++) {
+        const track_node& n = track[i];
+        if (n.type == NODE_NONE) continue;
+        printf("NODE name=%s type=%c num=%d rev=%s\n", n.name, (char)n.type,
+               n.num, track[n.reverse].name);
+        const size_t num_edges =
+            n.type == NODE_BRANCH ? 2 : n.type == NODE_EXIT ? 0 : 1;
+        for (size_t e = 0; e < num_edges; e++) {
+            print_edge(track, n, n.edge[e]);
+            print_reverse_edge(track, n, n.edge[e]);
+        }
+    }
+}
@@ -6,10 +6,12 @@
 
 enum class PriorityQueueErr : uint8_t { OK, FULL };
 
-template <class T, unsigned int N>
+/// Max-heap of up to N elements. Elements with the same priority are popped in
+/// the order they were pushed. `P` is the type of the priorities.
+template <class T, unsigned int N, class P = int>
 class PriorityQueue {
     struct Element {
-        int priority;
+        P priority;
 
         // Each element is issued a monotonically increasing 'ticket', to break
         // ties when priorities are equal. An element with a lower 'ticket' is
@@ -20,7 +22,7 @@ class PriorityQueue {
         std::optional<T> data;
 
         Element() = default;
-        Element(T data, int priority, size_t ticket)
+        Element(T data, P priority, size_t ticket)
             : priority(priority), ticket(ticket), data(data) {}
 
         bool operator<(const Element& other) const {
@@ -41,7 +43,7 @@ class PriorityQueue {
     bool is_empty() const { return len == 0; }
     size_t size() const { return len; }
 
-    PriorityQueueErr push(T t, int priority) {
+    PriorityQueueErr push(T t, P priority) {
         if (len >= N) return PriorityQueueErr::FULL;
 
         len++;
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+/// Describes a particular track sensor (e.g: {'C', 13} for C13)
+struct sensor_t {
+    char group;
+    uint8_t idx;
+
+    bool operator==(const sensor_t& other) const {
+        return this->group == other.group && this->idx == other.idx;
+    }
+
+    bool operator!=(const sensor_t& other) const { return !(*this == other); }
+};
+
+namespace sensor_bitmap_detail {
+struct Clz8Table {
+    uint8_t clz[256];
+
+    constexpr Clz8Table() : clz{} {
+        clz[0] = 8;
+        for (size_t i = 1; i < 256; i++) {
+            uint8_t n = 0;
+            while (!((i << n) & 0x80)) n++;
+            clz[i] = n;
+        }
+    }
+};
+
+// The ARM920T is an ARMv4T core, which doesn't have a CLZ instruction, so a
+// byte-sized lookup table is used instead.
+constexpr Clz8Table CLZ8 = Clz8Table();
+
+inline uint8_t clz16(uint16_t w) {
+    const uint8_t hi = (uint8_t)(w >> 8);
+    if (hi != 0) return CLZ8.clz[hi];
+    return (uint8_t)(8 + CLZ8.clz[w & 0xff]);
+}
+}  // namespace sensor_bitmap_detail
+
+/// Set of triggered sensors, as reported by a Marklin sensor dump.
+class SensorBitmap {
+   public:
+    static constexpr size_t NUM_GROUPS = 5;
+    /// Length of a raw sensor dump
+    static constexpr size_t RAW_LEN = 2 * NUM_GROUPS;
+
+   private:
+    // one word per group, with sensor 1 in the MSB and sensor 16 in the LSB
+    // (which is exactly the order that the Marklin sends them in).
+    uint16_t groups[NUM_GROUPS];
+
+   public:
+    SensorBitmap() : groups{} {}
+
+    /// Decode a raw sensor dump.
+    static SensorBitmap from_raw(const char raw[RAW_LEN]) {
+        SensorBitmap b;
+        for (size_t g = 0; g < NUM_GROUPS; g++) {
+            b.groups[g] = (uint16_t)(((uint8_t)raw[2 * g] << 8) |
+                                     (uint8_t)raw[2 * g + 1]);
+        }
+        return b;
+    }
+
+    bool is_empty() const {
+        uint16_t any = 0;
+        for (uint16_t w : groups) any |= w;
+        return any == 0;
+    }
+
+    bool is_set(const sensor_t& s) const {
+        const size_t g = (size_t)(s.group - 'A');
+        if (g >= NUM_GROUPS || s.idx < 1 || s.idx > 16) return false;
+        return groups[g] & (0x8000 >> (s.idx - 1));
+    }
+
+    SensorBitmap operator^(const SensorBitmap& other) const {
+        SensorBitmap b;
+        for (size_t g = 0; g < NUM_GROUPS; g++)
+            b.groups[g] = (uint16_t)(groups[g] ^ other.groups[g]);
+        return b;
+    }
+
+    SensorBitmap operator&(const SensorBitmap& other) const {
+        SensorBitmap b;
+        for (size_t g = 0; g < NUM_GROUPS; g++)
+            b.groups[g] = (uint16_t)(groups[g] & other.groups[g]);
+        return b;
+    }
+
+    /// Returns the sensors which are set in this report, but weren't set in
+    /// `prev`.
+    SensorBitmap rising_edges(const SensorBitmap& prev) const {
+        return (*this ^ prev) & *this;
+    }
+
+    /// Writes up to `max` set sensors into `out` (in A1..E16 order), returning
+    /// the number of sensors written.
+    size_t extract(sensor_t* out, size_t max) const {
+        size_t n = 0;
+        for (size_t g = 0; g < NUM_GROUPS; g++) {
+            uint16_t w = groups[g];
+            while (w != 0) {
+                if (n == max) return n;
+                const uint8_t lz = sensor_bitmap_detail::clz16(w);
+                w = (uint16_t)(w & ~(0x8000 >> lz));
+                out[n++] = {.group = (char)('A' + g), .idx = (uint8_t)(lz + 1)};
+            }
+        }
+        return n;
+    }
+
+    /// Removes and returns the first set sensor (in A1..E16 order).
+    std::optional<sensor_t> pop_front() {
+        for (size_t g = 0; g < NUM_GROUPS; g++) {
+            if (groups[g] == 0) continue;
+            const uint8_t lz = sensor_bitmap_detail::clz16(groups[g]);
+            groups[g] = (uint16_t)(groups[g] & ~(0x8000 >> lz));
+            return sensor_t{.group = (char)('A' + g), .idx = (uint8_t)(lz + 1)};
+        }
+        return std::nullopt;
+    }
+};
@@ -0,0 +1,303 @@
+/* THIS FILE IS GENERATED CODE -- DO NOT EDIT */
+
+#pragma once
+
+#include "common/track_node.h"
+
+namespace TrackData {
+
+inline constexpr track_node TRACKA[TRACK_MAX] = {
+    {"A1", NODE_SENSOR, 0, 1, {{103, 231}, {0, 0}}},
+    {"A2", NODE_SENSOR, 1, 0, {{133, 504}, {0, 0}}},
+    {"A3", NODE_SENSOR, 2, 3, {{106, 43}, {0, 0}}},
+    {"A4", NODE_SENSOR, 3, 2, {{31, 437}, {0, 0}}},
+    {"A5", NODE_SENSOR, 4, 5, {{85, 231}, {0, 0}}},
+    {"A6", NODE_SENSOR, 5, 4, {{25, 642}, {0, 0}}},
+    {"A7", NODE_SENSOR, 6, 7, {{27, 470}, {0, 0}}},
+    {"A8", NODE_SENSOR, 7, 6, {{83, 229}, {0, 0}}},
+    {"A9", NODE_SENSOR, 8, 9, {{23, 289}, {0, 0}}},
+    {"A10", NODE_SENSOR, 9, 8, {{81, 229}, {0, 0}}},
+    {"A11", NODE_SENSOR, 10, 11, {{81, 518}, {0, 0}}},
+    {"A12", NODE_SENSOR, 11, 10, {{139, 43}, {0, 0}}},
+    {"A13", NODE_SENSOR, 12, 13, {{87, 236}, {0, 0}}},
+    {"A14", NODE_SENSOR, 13, 12, {{131, 325}, {0, 0}}},
+    {"A15", NODE_SENSOR, 14, 15, {{135, 144}, {0, 0}}},
+    {"A16", NODE_SENSOR, 15, 14, {{87, 417}, {0, 0}}},
+    {"B1", NODE_SENSOR, 16, 17, {{61, 404}, {0, 0}}},
+    {"B2", NODE_SENSOR, 17, 16, {{111, 231}, {0, 0}}},
+    {"B3", NODE_SENSOR, 18, 19, {{33, 201}, {0, 0}}},
+    {"B4", NODE_SENSOR, 19, 18, {{111, 239}, {0, 0}}},
+    {"B5", NODE_SENSOR, 20, 21, {{50, 404}, {0, 0}}},
+    {"B6", NODE_SENSOR, 21, 20, {{105, 231}, {0, 0}}},
+    {"B7", NODE_SENSOR, 22, 23, {{9, 289}, {0, 0}}},
+    {"B8", NODE_SENSOR, 23, 22, {{137, 43}, {0, 0}}},
+    {"B9", NODE_SENSOR, 24, 25, {{4, 642}, {0, 0}}},
+    {"B10", NODE_SENSOR, 25, 24, {{141, 50}, {0, 0}}},
+    {"B11", NODE_SENSOR, 26, 27, {{7, 470}, {0, 0}}},
+    {"B12", NODE_SENSOR, 27, 26, {{143, 50}, {0, 0}}},
+    {"B13", NODE_SENSOR, 28, 29, {{119, 239}, {0, 0}}},
+    {"B14", NODE_SENSOR, 29, 28, {{63, 201}, {0, 0}}},
+    {"B15", NODE_SENSOR, 30, 31, {{2, 437}, {0, 0}}},
+    {"B16", NODE_SENSOR, 31, 30, {{108, 50}, {0, 0}}},
+    {"C1", NODE_SENSOR, 32, 33, {{19, 201}, {0, 0}}},
+    {"C2", NODE_SENSOR, 33, 32, {{117, 246}, {0, 0}}},
+    {"C3", NODE_SENSOR, 34, 35, {{129, 514}, {0, 0}}},
+    {"C4", NODE_SENSOR, 35, 34, {{89, 239}, {0, 0}}},
+    {"C5", NODE_SENSOR, 36, 37, {{90, 61}, {0, 0}}},
+    {"C6", NODE_SENSOR, 37, 36, {{109, 433}, {0, 0}}},
+    {"C7", NODE_SENSOR, 38, 39, {{115, 231}, {0, 0}}},
+    {"C8", NODE_SENSOR, 39, 38, {{84, 128}, {0, 0}}},
+    {"C9", NODE_SENSOR, 40, 41, {{109, 326}, {0, 0}}},
+    {"C10", NODE_SENSOR, 41, 40, {{110, 128}, {0, 0}}},
+    {"C11", NODE_SENSOR, 42, 43, {{104, 120}, {0, 0}}},
+    {"C12", NODE_SENSOR, 43, 42, {{107, 333}, {0, 0}}},
+    {"C13", NODE_SENSOR, 44, 45, {{70, 875}, {0, 0}}},
+    {"C14", NODE_SENSOR, 45, 44, {{100, 43}, {0, 0}}},
+    {"C15", NODE_SENSOR, 46, 47, {{59, 404}, {0, 0}}},
+    {"C16", NODE_SENSOR, 47, 46, {{91, 239}, {0, 0}}},
+    {"D1", NODE_SENSOR, 48, 49, {{121, 246}, {0, 0}}},
+    {"D2", NODE_SENSOR, 49, 48, {{67, 201}, {0, 0}}},
+    {"D3", NODE_SENSOR, 50, 51, {{99, 239}, {0, 0}}},
+    {"D4", NODE_SENSOR, 51, 50, {{21, 404}, {0, 0}}},
+    {"D5", NODE_SENSOR, 52, 53, {{69, 376}, {0, 0}}},
+    {"D6", NODE_SENSOR, 53, 52, {{97, 239}, {0, 0}}},
+    {"D7", NODE_SENSOR, 54, 55, {{97, 309}, {0, 0}}},
+    {"D8", NODE_SENSOR, 55, 54, {{71, 384}, {0, 0}}},
+    {"D9", NODE_SENSOR, 56, 57, {{75, 369}, {0, 0}}},
+    {"D10", NODE_SENSOR, 57, 56, {{95, 316}, {0, 0}}},
+    {"D11", NODE_SENSOR, 58, 59, {{47, 404}, {0, 0}}},
+    {"D12", NODE_SENSOR, 59, 58, {{93, 231}, {0, 0}}},
+    {"D13", NODE_SENSOR, 60, 61, {{17, 404}, {0, 0}}},
+    {"D14", NODE_SENSOR, 61, 60, {{113, 239}, {0, 0}}},
+    {"D15", NODE_SENSOR, 62, 63, {{28, 201}, {0, 0}}},
+    {"D16", NODE_SENSOR, 63, 62, {{113, 246}, {0, 0}}},
+    {"E1", NODE_SENSOR, 64, 65, {{123, 239}, {0, 0}}},
+    {"E2", NODE_SENSOR, 65, 64, {{78, 201}, {0, 0}}},
+    {"E3", NODE_SENSOR, 66, 67, {{48, 201}, {0, 0}}},
+    {"E4", NODE_SENSOR, 67, 66, {{99, 239}, {0, 0}}},
+    {"E5", NODE_SENSOR, 68, 69, {{53, 376}, {0, 0}}},
+    {"E6", NODE_SENSOR, 69, 68, {{98, 50}, {0, 0}}},
+    {"E7", NODE_SENSOR, 70, 71, {{54, 384}, {0, 0}}},
+    {"E8", NODE_SENSOR, 71, 70, {{45, 875}, {0, 0}}},
+    {"E9", NODE_SENSOR, 72, 73, {{95, 239}, {0, 0}}},
+    {"E10", NODE_SENSOR, 73, 72, {{76, 376}, {0, 0}}},
+    {"E11", NODE_SENSOR, 74, 75, {{57, 369}, {0, 0}}},
+    {"E12", NODE_SENSOR, 75, 74, {{92, 50}, {0, 0}}},
+    {"E13", NODE_SENSOR, 76, 77, {{112, 43}, {0, 0}}},
+    {"E14", NODE_SENSOR, 77, 76, {{72, 376}, {0, 0}}},
+    {"E15", NODE_SENSOR, 78, 79, {{105, 246}, {0, 0}}},
+    {"E16", NODE_SENSOR, 79, 78, {{64, 201}, {0, 0}}},
+    {"BR1", NODE_BRANCH, 1, 81, {{11, 518}, {8, 229}}},
+    {"MR1", NODE_MERGE, 1, 80, {{83, 188}, {0, 0}}},
+    {"BR2", NODE_BRANCH, 2, 83, {{80, 188}, {6, 229}}},
+    {"MR2", NODE_MERGE, 2, 82, {{85, 185}, {0, 0}}},
+    {"BR3", NODE_BRANCH, 3, 85, {{5, 231}, {82, 185}}},
+    {"MR3", NODE_MERGE, 3, 84, {{38, 128}, {0, 0}}},
+    {"BR4", NODE_BRANCH, 4, 87, {{14, 417}, {13, 236}}},
+    {"MR4", NODE_MERGE, 4, 86, {{103, 185}, {0, 0}}},
+    {"BR5", NODE_BRANCH, 5, 89, {{34, 239}, {93, 371}}},
+    {"MR5", NODE_MERGE, 5, 88, {{114, 155}, {0, 0}}},
+    {"BR6", NODE_BRANCH, 6, 91, {{46, 239}, {115, 371}}},
+    {"MR6", NODE_MERGE, 6, 90, {{37, 61}, {0, 0}}},
+    {"BR7", NODE_BRANCH, 7, 93, {{58, 231}, {89, 371}}},
+    {"MR7", NODE_MERGE, 7, 92, {{74, 50}, {0, 0}}},
+    {"BR8", NODE_BRANCH, 8, 95, {{56, 316}, {73, 239}}},
+    {"MR8", NODE_MERGE, 8, 94, {{96, 155}, {0, 0}}},
+    {"BR9", NODE_BRANCH, 9, 97, {{55, 309}, {52, 239}}},
+    {"MR9", NODE_MERGE, 9, 96, {{94, 155}, {0, 0}}},
+    {"BR10", NODE_BRANCH, 10, 99, {{51, 239}, {66, 239}}},
+    {"MR10", NODE_MERGE, 10, 98, {{68, 50}, {0, 0}}},
+    {"BR11", NODE_BRANCH, 11, 101, {{102, 188}, {107, 495}}},
+    {"MR11", NODE_MERGE, 11, 100, {{44, 43}, {0, 0}}},
+    {"BR12", NODE_BRANCH, 12, 103, {{1, 231}, {86, 185}}},
+    {"MR12", NODE_MERGE, 12, 102, {{101, 188}, {0, 0}}},
+    {"BR13", NODE_BRANCH, 13, 105, {{20, 231}, {79, 246}}},
+    {"MR13", NODE_MERGE, 13, 104, {{43, 120}, {0, 0}}},
+    {"BR14", NODE_BRANCH, 14, 107, {{101, 495}, {42, 333}}},
+    {"MR14", NODE_MERGE, 14, 106, {{3, 43}, {0, 0}}},
+    {"BR15", NODE_BRANCH, 15, 109, {{36, 433}, {41, 326}}},
+    {"MR15", NODE_MERGE, 15, 108, {{30, 50}, {0, 0}}},
+    {"BR16", NODE_BRANCH, 16, 111, {{16, 231}, {18, 239}}},
+    {"MR16", NODE_MERGE, 16, 110, {{40, 128}, {0, 0}}},
+    {"BR17", NODE_BRANCH, 17, 113, {{60, 239}, {62, 246}}},
+    {"MR17", NODE_MERGE, 17, 112, {{77, 43}, {0, 0}}},
+    {"BR18", NODE_BRANCH, 18, 115, {{39, 231}, {91, 371}}},
+    {"MR18", NODE_MERGE, 18, 114, {{88, 155}, {0, 0}}},
+    {"BR153", NODE_BRANCH, 153, 117, {{125, 253}, {32, 246}}},
+    {"MR153", NODE_MERGE, 153, 116, {{119, 0}, {0, 0}}},
+    {"BR154", NODE_BRANCH, 154, 119, {{116, 0}, {29, 239}}},
+    {"MR154", NODE_MERGE, 154, 118, {{122, 0}, {0, 0}}},
+    {"BR155", NODE_BRANCH, 155, 121, {{127, 282}, {49, 246}}},
+    {"MR155", NODE_MERGE, 155, 120, {{123, 0}, {0, 0}}},
+    {"BR156", NODE_BRANCH, 156, 123, {{120, 0}, {65, 239}}},
+    {"MR156", NODE_MERGE, 156, 122, {{118, 0}, {0, 0}}},
+    {"EN1", NODE_ENTER, 0, 125, {{117, 253}, {0, 0}}},
+    {"EX1", NODE_EXIT, 0, 124, {{0, 0}, {0, 0}}},
+    {"EN2", NODE_ENTER, 0, 127, {{121, 282}, {0, 0}}},
+    {"EX2", NODE_EXIT, 0, 126, {{0, 0}, {0, 0}}},
+    {"EN3", NODE_ENTER, 0, 129, {{35, 514}, {0, 0}}},
+    {"EX3", NODE_EXIT, 0, 128, {{0, 0}, {0, 0}}},
+    {"EN4", NODE_ENTER, 0, 131, {{12, 325}, {0, 0}}},
+    {"EX4", NODE_EXIT, 0, 130, {{0, 0}, {0, 0}}},
+    {"EN5", NODE_ENTER, 0, 133, {{0, 504}, {0, 0}}},
+    {"EX5", NODE_EXIT, 0, 132, {{0, 0}, {0, 0}}},
+    {"EN6", NODE_ENTER, 0, 135, {{15, 144}, {0, 0}}},
+    {"EX6", NODE_EXIT, 0, 134, {{0, 0}, {0, 0}}},
+    {"EN7", NODE_ENTER, 0, 137, {{22, 43}, {0, 0}}},
+    {"EX7", NODE_EXIT, 0, 136, {{0, 0}, {0, 0}}},
+    {"EN8", NODE_ENTER, 0, 139, {{10, 43}, {0, 0}}},
+    {"EX8", NODE_EXIT, 0, 138, {{0, 0}, {0, 0}}},
+    {"EN9", NODE_ENTER, 0, 141, {{24, 50}, {0, 0}}},
+    {"EX9", NODE_EXIT, 0, 140, {{0, 0}, {0, 0}}},
+    {"EN10", NODE_ENTER, 0, 143, {{26, 50}, {0, 0}}},
+    {"EX10", NODE_EXIT, 0, 142, {{0, 0}, {0, 0}}},
+};
+
+inline constexpr track_node TRACKB[TRACK_MAX] = {
+    {"A1", NODE_SENSOR, 0, 1, {{103, 231}, {0, 0}}},
+    {"A2", NODE_SENSOR, 1, 0, {{133, 504}, {0, 0}}},
+    {"A3", NODE_SENSOR, 2, 3, {{106, 43}, {0, 0}}},
+    {"A4", NODE_SENSOR, 3, 2, {{31, 437}, {0, 0}}},
+    {"A5", NODE_SENSOR, 4, 5, {{85, 231}, {0, 0}}},
+    {"A6", NODE_SENSOR, 5, 4, {{25, 642}, {0, 0}}},
+    {"A7", NODE_SENSOR, 6, 7, {{27, 470}, {0, 0}}},
+    {"A8", NODE_SENSOR, 7, 6, {{83, 229}, {0, 0}}},
+    {"A9", NODE_SENSOR, 8, 9, {{23, 289}, {0, 0}}},
+    {"A10", NODE_SENSOR, 9, 8, {{81, 229}, {0, 0}}},
+    {"A11", NODE_SENSOR, 10, 11, {{81, 282}, {0, 0}}},
+    {"A12", NODE_SENSOR, 11, 10, {{15, 814}, {0, 0}}},
+    {"A13", NODE_SENSOR, 12, 13, {{87, 236}, {0, 0}}},
+    {"A14", NODE_SENSOR, 13, 12, {{131, 325}, {0, 0}}},
+    {"A15", NODE_SENSOR, 14, 15, {{10, 814}, {0, 0}}},
+    {"A16", NODE_SENSOR, 15, 14, {{87, 275}, {0, 0}}},
+    {"B1", NODE_SENSOR, 16, 17, {{61, 404}, {0, 0}}},
+    {"B2", NODE_SENSOR, 17, 16, {{111, 231}, {0, 0}}},
+    {"B3", NODE_SENSOR, 18, 19, {{33, 201}, {0, 0}}},
+    {"B4", NODE_SENSOR, 19, 18, {{111, 239}, {0, 0}}},
+    {"B5", NODE_SENSOR, 20, 21, {{50, 404}, {0, 0}}},
+    {"B6", NODE_SENSOR, 21, 20, {{105, 231}, {0, 0}}},
+    {"B7", NODE_SENSOR, 22, 23, {{9, 289}, {0, 0}}},
+    {"B8", NODE_SENSOR, 23, 22, {{135, 43}, {0, 0}}},
+    {"B9", NODE_SENSOR, 24, 25, {{4, 642}, {0, 0}}},
+    {"B10", NODE_SENSOR, 25, 24, {{137, 50}, {0, 0}}},
+    {"B11", NODE_SENSOR, 26, 27, {{7, 470}, {0, 0}}},
+    {"B12", NODE_SENSOR, 27, 26, {{139, 50}, {0, 0}}},
+    {"B13", NODE_SENSOR, 28, 29, {{119, 239}, {0, 0}}},
+    {"B14", NODE_SENSOR, 29, 28, {{63, 201}, {0, 0}}},
+    {"B15", NODE_SENSOR, 30, 31, {{2, 437}, {0, 0}}},
+    {"B16", NODE_SENSOR, 31, 30, {{108, 50}, {0, 0}}},
+    {"C1", NODE_SENSOR, 32, 33, {{19, 201}, {0, 0}}},
+    {"C2", NODE_SENSOR, 33, 32, {{117, 246}, {0, 0}}},
+    {"C3", NODE_SENSOR, 34, 35, {{129, 514}, {0, 0}}},
+    {"C4", NODE_SENSOR, 35, 34, {{89, 239}, {0, 0}}},
+    {"C5", NODE_SENSOR, 36, 37, {{90, 61}, {0, 0}}},
+    {"C6", NODE_SENSOR, 37, 36, {{109, 433}, {0, 0}}},
+    {"C7", NODE_SENSOR, 38, 39, {{115, 231}, {0, 0}}},
+    {"C8", NODE_SENSOR, 39, 38, {{84, 128}, {0, 0}}},
+    {"C9", NODE_SENSOR, 40, 41, {{109, 326}, {0, 0}}},
+    {"C10", NODE_SENSOR, 41, 40, {{110, 128}, {0, 0}}},
+    {"C11", NODE_SENSOR, 42, 43, {{104, 120}, {0, 0}}},
+    {"C12", NODE_SENSOR, 43, 42, {{107, 333}, {0, 0}}},
+    {"C13", NODE_SENSOR, 44, 45, {{70, 780}, {0, 0}}},
+    {"C14", NODE_SENSOR, 45, 44, {{100, 50}, {0, 0}}},
+    {"C15", NODE_SENSOR, 46, 47, {{59, 404}, {0, 0}}},
+    {"C16", NODE_SENSOR, 47, 46, {{91, 239}, {0, 0}}},
+    {"D1", NODE_SENSOR, 48, 49, {{121, 246}, {0, 0}}},
+    {"D2", NODE_SENSOR, 49, 48, {{67, 201}, {0, 0}}},
+    {"D3", NODE_SENSOR, 50, 51, {{99, 239}, {0, 0}}},
+    {"D4", NODE_SENSOR, 51, 50, {{21, 404}, {0, 0}}},
+    {"D5", NODE_SENSOR, 52, 53, {{69, 282}, {0, 0}}},
+    {"D6", NODE_SENSOR, 53, 52, {{97, 229}, {0, 0}}},
+    {"D7", NODE_SENSOR, 54, 55, {{97, 309}, {0, 0}}},
+    {"D8", NODE_SENSOR, 55, 54, {{71, 376}, {0, 0}}},
+    {"D9", NODE_SENSOR, 56, 57, {{75, 282}, {0, 0}}},
+    {"D10", NODE_SENSOR, 57, 56, {{95, 316}, {0, 0}}},
+    {"D11", NODE_SENSOR, 58, 59, {{47, 404}, {0, 0}}},
+    {"D12", NODE_SENSOR, 59, 58, {{93, 231}, {0, 0}}},
+    {"D13", NODE_SENSOR, 60, 61, {{17, 404}, {0, 0}}},
+    {"D14", NODE_SENSOR, 61, 60, {{113, 239}, {0, 0}}},
+    {"D15", NODE_SENSOR, 62, 63, {{28, 201}, {0, 0}}},
+    {"D16", NODE_SENSOR, 63, 62, {{113, 246}, {0, 0}}},
+    {"E1", NODE_SENSOR, 64, 65, {{123, 239}, {0, 0}}},
+    {"E2", NODE_SENSOR, 65, 64, {{78, 201}, {0, 0}}},
+    {"E3", NODE_SENSOR, 66, 67, {{48, 201}, {0, 0}}},
+    {"E4", NODE_SENSOR, 67, 66, {{99, 239}, {0, 0}}},
+    {"E5", NODE_SENSOR, 68, 69, {{53, 282}, {0, 0}}},
+    {"E6", NODE_SENSOR, 69, 68, {{98, 50}, {0, 0}}},
+    {"E7", NODE_SENSOR, 70, 71, {{54, 376}, {0, 0}}},
+    {"E8", NODE_SENSOR, 71, 70, {{45, 780}, {0, 0}}},
+    {"E9", NODE_SENSOR, 72, 73, {{95, 239}, {0, 0}}},
+    {"E10", NODE_SENSOR, 73, 72, {{76, 282}, {0, 0}}},
+    {"E11", NODE_SENSOR, 74, 75, {{57, 282}, {0, 0}}},
+    {"E12", NODE_SENSOR, 75, 74, {{92, 43}, {0, 0}}},
+    {"E13", NODE_SENSOR, 76, 77, {{112, 43}, {0, 0}}},
+    {"E14", NODE_SENSOR, 77, 76, {{72, 282}, {0, 0}}},
+    {"E15", NODE_SENSOR, 78, 79, {{105, 246}, {0, 0}}},
+    {"E16", NODE_SENSOR, 79, 78, {{64, 201}, {0, 0}}},
+    {"BR1", NODE_BRANCH, 1, 81, {{11, 282}, {8, 229}}},
+    {"MR1", NODE_MERGE, 1, 80, {{83, 188}, {0, 0}}},
+    {"BR2", NODE_BRANCH, 2, 83, {{80, 188}, {6, 229}}},
+    {"MR2", NODE_MERGE, 2, 82, {{85, 185}, {0, 0}}},
+    {"BR3", NODE_BRANCH, 3, 85, {{5, 231}, {82, 185}}},
+    {"MR3", NODE_MERGE, 3, 84, {{38, 128}, {0, 0}}},
+    {"BR4", NODE_BRANCH, 4, 87, {{14, 275}, {13, 236}}},
+    {"MR4", NODE_MERGE, 4, 86, {{103, 185}, {0, 0}}},
+    {"BR5", NODE_BRANCH, 5, 89, {{34, 239}, {93, 371}}},
+    {"MR5", NODE_MERGE, 5, 88, {{114, 155}, {0, 0}}},
+    {"BR6", NODE_BRANCH, 6, 91, {{46, 239}, {115, 371}}},
+    {"MR6", NODE_MERGE, 6, 90, {{37, 61}, {0, 0}}},
+    {"BR7", NODE_BRANCH, 7, 93, {{58, 231}, {89, 371}}},
+    {"MR7", NODE_MERGE, 7, 92, {{74, 43}, {0, 0}}},
+    {"BR8", NODE_BRANCH, 8, 95, {{56, 316}, {73, 239}}},
+    {"MR8", NODE_MERGE, 8, 94, {{96, 155}, {0, 0}}},
+    {"BR9", NODE_BRANCH, 9, 97, {{55, 309}, {52, 229}}},
+    {"MR9", NODE_MERGE, 9, 96, {{94, 155}, {0, 0}}},
+    {"BR10", NODE_BRANCH, 10, 99, {{51, 239}, {66, 239}}},
+    {"MR10", NODE_MERGE, 10, 98, {{68, 50}, {0, 0}}},
+    {"BR11", NODE_BRANCH, 11, 101, {{102, 188}, {107, 495}}},
+    {"MR11", NODE_MERGE, 11, 100, {{44, 50}, {0, 0}}},
+    {"BR12", NODE_BRANCH, 12, 103, {{1, 231}, {86, 185}}},
+    {"MR12", NODE_MERGE, 12, 102, {{101, 188}, {0, 0}}},
+    {"BR13", NODE_BRANCH, 13, 105, {{20, 231}, {79, 246}}},
+    {"MR13", NODE_MERGE, 13, 104, {{43, 120}, {0, 0}}},
+    {"BR14", NODE_BRANCH, 14, 107, {{101, 495}, {42, 333}}},
+    {"MR14", NODE_MERGE, 14, 106, {{3, 43}, {0, 0}}},
+    {"BR15", NODE_BRANCH, 15, 109, {{36, 433}, {41, 326}}},
+    {"MR15", NODE_MERGE, 15, 108, {{30, 50}, {0, 0}}},
+    {"BR16", NODE_BRANCH, 16, 111, {{16, 231}, {18, 239}}},
+    {"MR16", NODE_MERGE, 16, 110, {{40, 128}, {0, 0}}},
+    {"BR17", NODE_BRANCH, 17, 113, {{60, 239}, {62, 246}}},
+    {"MR17", NODE_MERGE, 17, 112, {{77, 43}, {0, 0}}},
+    {"BR18", NODE_BRANCH, 18, 115, {{39, 231}, {91, 371}}},
+    {"MR18", NODE_MERGE, 18, 114, {{88, 155}, {0, 0}}},
+    {"BR153", NODE_BRANCH, 153, 117, {{125, 253}, {32, 246}}},
+    {"MR153", NODE_MERGE, 153, 116, {{119, 0}, {0, 0}}},
+    {"BR154", NODE_BRANCH, 154, 119, {{116, 0}, {29, 239}}},
+    {"MR154", NODE_MERGE, 154, 118, {{122, 0}, {0, 0}}},
+    {"BR155", NODE_BRANCH, 155, 121, {{127, 282}, {49, 246}}},
+    {"MR155", NODE_MERGE, 155, 120, {{123, 0}, {0, 0}}},
+    {"BR156", NODE_BRANCH, 156, 123, {{120, 0}, {65, 239}}},
+    {"MR156", NODE_MERGE, 156, 122, {{118, 0}, {0, 0}}},
+    {"EN1", NODE_ENTER, 0, 125, {{117, 253}, {0, 0}}},
+    {"EX1", NODE_EXIT, 0, 124, {{0, 0}, {0, 0}}},
+    {"EN2", NODE_ENTER, 0, 127, {{121, 282}, {0, 0}}},
+    {"EX2", NODE_EXIT, 0, 126, {{0, 0}, {0, 0}}},
+    {"EN3", NODE_ENTER, 0, 129, {{35, 514}, {0, 0}}},
+    {"EX3", NODE_EXIT, 0, 128, {{0, 0}, {0, 0}}},
+    {"EN4", NODE_ENTER, 0, 131, {{12, 325}, {0, 0}}},
+    {"EX4", NODE_EXIT, 0, 130, {{0, 0}, {0, 0}}},
+    {"EN5", NODE_ENTER, 0, 133, {{0, 504}, {0, 0}}},
+    {"EX5", NODE_EXIT, 0, 132, {{0, 0}, {0, 0}}},
+    {"EN7", NODE_ENTER, 0, 135, {{22, 43}, {0, 0}}},
+    {"EX7", NODE_EXIT, 0, 134, {{0, 0}, {0, 0}}},
+    {"EN9", NODE_ENTER, 0, 137, {{24, 50}, {0, 0}}},
+    {"EX9", NODE_EXIT, 0, 136, {{0, 0}, {0, 0}}},
+    {"EN10", NODE_ENTER, 0, 139, {{26, 50}, {0, 0}}},
+    {"EX10", NODE_EXIT, 0, 138, {{0, 0}, {0, 0}}},
+    {"", NODE_NONE, 0, 0, {{0, 0}, {0, 0}}},
+    {"", NODE_NONE, 0, 0, {{0, 0}, {0, 0}}},
+    {"", NODE_NONE, 0, 0, {{0, 0}, {0, 0}}},
+    {"", NODE_NONE, 0, 0, {{0, 0}, {0, 0}}},
+};
+
+}  // namespace TrackData
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/// Every track's node table has exactly this many entries (unused entries are
+/// NODE_NONE).
+constexpr size_t TRACK_MAX = 144;
+
+enum node_type : uint8_t {
+    NODE_NONE,
+    NODE_SENSOR,
+    NODE_BRANCH,
+    NODE_MERGE,
+    NODE_ENTER,
+    NODE_EXIT,
+};
+
+#define DIR_AHEAD 0
+#define DIR_STRAIGHT 0
+#define DIR_CURVED 1
+
+// Nodes refer to each other by their index in the track's node table, rather
+// than by pointer, so that the tables can be built at compile time and live
+// in .rodata.
+
+struct track_edge {
+    uint8_t dest; /* index of the node this edge leads to */
+    int dist;     /* in millimetres */
+};
+
+struct track_node {
+    char name[6];
+    node_type type;
+    int num;         /* sensor or switch number */
+    uint8_t reverse; /* same location, but opposite direction */
+    track_edge edge[2];
+};
@@ -1,13 +1,31 @@
 #pragma once
 
+#include <cstdint>
+
 namespace Clock {
 void Server();
 
 int Time(int tid);
 int Delay(int tid, int ticks);
 int DelayUntil(int tid, int ticks);
+
+/// Blocks until the calling task's next period boundary. The first call
+/// registers the task, and returns `period` ticks later. Each subsequent call
+/// returns on the next multiple of `period` from that first boundary, so
+/// periodic work stays phase-locked regardless of how long it takes (boundaries
+/// that have already passed are skipped). Calling with a period <= 0
+/// unregisters the task and returns immediately.
+int Periodic(int tid, int period);
 void Shutdown(int tid);
 
+/// Returns the number of microseconds since the kernel started TIMER3.
+///
+/// Unlike the other Clock methods, TimeUs doesn't send a message to the clock
+/// server, and reads the free-running 508 kHz TIMER3 directly. The clock server
+/// must be running for timestamps to stay monotonic across TIMER3 wraparound
+/// (which happens every ~2.3 hours).
+uint64_t TimeUs();
+
 extern const char* SERVER_ID;
 
 }  // namespace Clock
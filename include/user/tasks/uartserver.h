@@ -1,27 +1,92 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 
 namespace Uart {
+
+/// Output lanes. Writes to the Urgent lane are sent before any writes queued
+/// in the Normal lane, but never in the middle of one (e.g: an emergency stop
+/// can jump ahead of queued switch commands, without splitting a command).
+enum class Lane { Normal, Urgent };
+
 extern const char* SERVER_ID;
+extern const char* COM1_SERVER_ID;
+extern const char* COM2_SERVER_ID;
+
+/// Serves both COM1 and COM2 from a single task, registered as SERVER_ID.
 void Server();
+
+/// Serve a single channel, registered as COM1_SERVER_ID / COM2_SERVER_ID
+/// respectively. Running one server per channel ensures that traffic on one
+/// channel is never queued behind traffic on the other (e.g: Marklin commands
+/// behind a burst of terminal output), and lets each channel be given its own
+/// priority. Requests for the other channel will panic.
+void COM1Server();
+void COM2Server();
+
 int Getc(int tid, int channel);
 int Putc(int tid, int channel, char c);
 
 // Getn blocks until n bytes are received from the UART, writing the bytes to
-// buf.
+// buf. Incoming bytes are buffered by the server even when nobody is reading,
+// and concurrent readers are served in the order they called Getn. n may be at
+// most 512 bytes.
 int Getn(int tid, int channel, size_t n, char* buf);
 
-// Putstr and Printf can atomically write up to 4096 bytes to the UART in a
-// single call.
+// TryGetn writes up to n already-received bytes to buf without blocking,
+// returning the number of bytes written. Returns 0 if other tasks are blocked
+// in Getn on the same channel.
+int TryGetn(int tid, int channel, size_t n, char* buf);
+
+// Putstr and Printf atomically write a message to the UART in a single call.
+// If the channel's output buffer doesn't have room for the whole message, the
+// caller is blocked until enough of the buffer has drained.
+//
+// A message may be no longer than the channel's output buffer (1024 bytes on
+// COM1 and 8192 on COM2, unless configured otherwise), and no longer than 4096
+// bytes on either channel (4095 for Printf). Longer messages are rejected:
+// nothing is written, and -1 is returned.
 int Putstr(int tid, int channel, const char* msg);
+
+// Putn atomically writes `len` bytes from buf (which may include NUL bytes) to
+// the given output lane, with the same limits as Putstr. Urgent writes are
+// further limited to 64 bytes in total at any one time, and any that don't fit
+// are rejected in the same way.
+int Putn(int tid,
+         int channel,
+         const char* buf,
+         size_t len,
+         Lane lane = Lane::Normal);
+
+/// Most frames a single PutFrames call can write.
+constexpr size_t MAX_PUT_FRAMES = 64;
+
+// PutFrames writes `num_frames` messages to the Normal lane in a single call,
+// the i-th being the next frame_lens[i] bytes of buf. The messages are written
+// as atomically as with Putn, but each is kept as its own frame, so urgent
+// writes may still be sent in between them. Returns the total number of bytes
+// written. The same limits apply as for Putn, and any more than MAX_PUT_FRAMES
+// frames are rejected as well.
+int PutFrames(int tid,
+              int channel,
+              const char* buf,
+              const uint8_t frame_lens[],
+              size_t num_frames);
+
+// TryPutstr writes as much of msg to the channel's output buffer as currently
+// fits, without blocking, and returns the number of bytes accepted.
+int TryPutstr(int tid, int channel, const char* msg);
 int Printf(int tid, int channel, const char* format, ...)
     __attribute__((format(printf, 3, 4)));
 
-// Drain empties the RX FIFO for the given channel.
+// Drain discards any bytes received on the given channel that haven't been read
+// yet. Any tasks blocked in Getn on the channel return -1.
 void Drain(int tid, int channel);
 
-// Flush blocks until the data buffered for the channel has been written
+// Flush blocks until the data buffered for the channel has been written.
+// Multiple tasks may Flush the same channel at once; each is released as soon
+// as the bytes queued before its own call have been sent.
 void Flush(int tid, int channel);
 
 // Getline reads a line of input from the uart into `line`, treating the
@@ -4,6 +4,7 @@
 #include <cstring>
 
 #include "common/queue.h"
+#include "common/sensor_bitmap.h"
 #include "common/ts7200.h"
 #include "common/vt_escapes.h"
 #include "user/debug.h"
@@ -33,44 +34,31 @@ void TimerTask() {
         Uart::Printf(uart, COM2,
                      VT_SAVE VT_ROWCOL(1, 1) "[%d:%02d:%d]" VT_RESTORE,
                      ticks / (100 * 60), (ticks / 100) % 60, (ticks / 10) % 10);
-        Clock::Delay(clock, 10);
+        Clock::Periodic(clock, 10);
     }
 }
 
-struct sensor_t {
-    char group;
-    uint8_t idx;
-
-    bool operator==(const sensor_t& other) const {
-        return this->group == other.group && this->idx == other.idx;
-    }
-};
-
 using SensorQueue = Queue<sensor_t, 10>;
 
 static size_t enqueue_sensors(const char bytes[NUM_SENSOR_GROUPS * 2],
                               SensorQueue& q) {
+    sensor_t sensors[NUM_SENSOR_GROUPS * 16];
+    size_t n =
+        SensorBitmap::from_raw(bytes).extract(sensors, NUM_SENSOR_GROUPS * 16);
+
     size_t ret = 0;
-    for (size_t bi = 0; bi < NUM_SENSOR_GROUPS * 2; bi++) {
-        char byte = bytes[bi];
-        for (size_t i = 1; i <= 8; i++) {
-            if ((byte >> (8 - i)) & 0x01) {
-                char group = (char)((int)'A' + (bi / 2));
-                uint8_t idx = (uint8_t)(i + (8 * (bi % 2)));
-
-                const sensor_t s = {.group = group, .idx = idx};
-
-                // Don't push the sensor onto the queue if it is the most
-                // recently triggered sensor.
-                if (q.size() > 0 && s == *q.peek_index(q.size() - 1)) {
-                    continue;
-                }
-
-                if (q.available() == 0) q.pop_front();
-                q.push_back(s);
-                ret++;
-            }
+    for (size_t i = 0; i < n; i++) {
+        const sensor_t& s = sensors[i];
+
+        // Don't push the sensor onto the queue if it is the most recently
+        // triggered sensor.
+        if (q.size() > 0 && s == *q.peek_index(q.size() - 1)) {
+            continue;
         }
+
+        if (q.available() == 0) q.pop_front();
+        q.push_back(s);
+        ret++;
     }
 
     return ret;
@@ -329,7 +317,7 @@ void PerfTask() {
         Uart::Printf(uart, COM2,
                      VT_SAVE VT_ROWCOL_FMT "[Idle Time %02lu%%]" VT_RESTORE, 1,
                      cfg.term_size.width - 14, perf.idle_time_pct);
-        Clock::Delay(clock, (int)25);
+        Clock::Periodic(clock, 25);
     }
 }
 
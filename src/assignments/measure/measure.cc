@@ -3,6 +3,7 @@
 #include <initializer_list>
 
 #include "common/bwio.h"
+#include "common/sensor_bitmap.h"
 #include "common/ts7200.h"
 #include "user/debug.h"
 #include "user/syscalls.h"
@@ -51,17 +52,6 @@ void make_outer_loop() {
     }
 }
 
-struct sensor_t {
-    char group;
-    uint8_t idx;
-
-    bool operator==(const sensor_t& other) const {
-        return this->group == other.group && this->idx == other.idx;
-    }
-
-    bool operator!=(const sensor_t& other) const { return !(*this == other); }
-};
-
 bool bwgetnextsensor(sensor_t& s) {
     char bytes[NUM_SENSOR_GROUPS * 2];
 
@@ -70,18 +60,7 @@ bool bwgetnextsensor(sensor_t& s) {
         c = (char)bwgetc(COM1);
     }
 
-    for (size_t bi = 0; bi < NUM_SENSOR_GROUPS * 2; bi++) {
-        char byte = bytes[bi];
-        for (size_t i = 1; i <= 8; i++) {
-            if ((byte >> (8 - i)) & 0x01) {
-                s.group = (char)((int)'A' + (bi / 2));
-                s.idx = (uint8_t)(i + (8 * (bi % 2)));
-                return true;
-            }
-        }
-    }
-
-    return false;
+    return SensorBitmap::from_raw(bytes).extract(&s, 1) == 1;
 }
 
 void set_up_track(uint8_t tr) {
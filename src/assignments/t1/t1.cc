@@ -184,10 +184,15 @@ static void do_route_cmd(const int uart,
 
                 std::optional<Marklin::BranchDir> dir = std::nullopt;
 
-                if (n.edge[DIR_STRAIGHT].dest == &next_n) {
+                const track_node* straight =
+                    &track_graph.node(n.edge[DIR_STRAIGHT].dest);
+                const track_node* curved =
+                    &track_graph.node(n.edge[DIR_CURVED].dest);
+
+                if (straight == &next_n) {
                     log_line(uart, "set branch %d to straight", n.num);
                     dir = Marklin::BranchDir::Straight;
-                } else if (n.edge[DIR_CURVED].dest == &next_n) {
+                } else if (curved == &next_n) {
                     log_line(uart, "set branch %d to curved", n.num);
                     dir = Marklin::BranchDir::Curved;
                 } else {
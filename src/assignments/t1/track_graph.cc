@@ -10,10 +10,10 @@ static constexpr size_t MAX_ITERS = 40;
 TrackGraph::TrackGraph(Marklin::Track t) {
     switch (t) {
         case Marklin::Track::A:
-            init_tracka(track);
+            track = TrackData::TRACKA;
             break;
         case Marklin::Track::B:
-            init_trackb(track);
+            track = TrackData::TRACKB;
             break;
         default:
             assert(false);
@@ -73,8 +73,8 @@ std::optional<std::pair<Marklin::sensor_t, int>> TrackGraph::next_sensor(
     const Marklin::BranchState* branches,
     size_t branches_len) const {
     const track_node* curr = nullptr;
-    for (auto& node : track) {
-        if (node_is_sensor(node, sensor)) curr = &node;
+    for (size_t i = 0; i < TRACK_MAX; i++) {
+        if (node_is_sensor(track[i], sensor)) curr = &track[i];
     }
     if (curr == nullptr) return std::nullopt;
     int distance = 0;
@@ -82,7 +82,7 @@ std::optional<std::pair<Marklin::sensor_t, int>> TrackGraph::next_sensor(
         auto edge = next_edge(*curr, branches, branches_len);
         if (edge == nullptr) return std::nullopt;
         distance += edge->dist;
-        curr = edge->dest;
+        curr = &track[edge->dest];
         if (curr->type == NODE_SENSOR)
             return std::make_pair(sensor_of_node(*curr), distance);
     }
@@ -97,9 +97,9 @@ std::optional<int> TrackGraph::distance_between(
           new_sensor.group, new_sensor.idx);
     const track_node* start = nullptr;
     const track_node* end = nullptr;
-    for (auto& node : track) {
-        if (node_is_sensor(node, old_sensor)) start = &node;
-        if (node_is_sensor(node, new_sensor)) end = &node;
+    for (size_t i = 0; i < TRACK_MAX; i++) {
+        if (node_is_sensor(track[i], old_sensor)) start = &track[i];
+        if (node_is_sensor(track[i], new_sensor)) end = &track[i];
     }
     assert(start != nullptr);
     assert(end != nullptr);
@@ -116,8 +116,9 @@ std::optional<int> TrackGraph::distance_between(
             // current track state.
             return std::nullopt;
         }
-        debug("  %s->%s: %dmm", curr->name, edge->dest->name, edge->dist);
-        curr = edge->dest;
+        debug("  %s->%s: %dmm", curr->name, track[edge->dest].name,
+              edge->dist);
+        curr = &track[edge->dest];
         distance += edge->dist;
 
         if (curr == start) {
@@ -133,11 +134,11 @@ std::optional<int> TrackGraph::distance_between(
 Marklin::sensor_t TrackGraph::invert_sensor(
     const Marklin::sensor_t& sensor) const {
     const track_node* node = nullptr;
-    for (auto& n : track) {
-        if (node_is_sensor(n, sensor)) node = &n;
+    for (size_t i = 0; i < TRACK_MAX; i++) {
+        if (node_is_sensor(track[i], sensor)) node = &track[i];
     }
     if (node == nullptr) panic("unknown sensor %c%u", sensor.group, sensor.idx);
-    return sensor_of_node(*node->reverse);
+    return sensor_of_node(track[node->reverse]);
 }
 
 std::optional<std::pair<Marklin::sensor_t, int /* distance, mm */>>
@@ -180,11 +181,6 @@ Marklin::track_pos_t TrackGraph::normalize(const Marklin::track_pos_t& pos,
     }
 }
 
-struct search_node_t {
-    track_node* node;
-    int total_distance;
-};
-
 static inline size_t index_of(const track_node* node,
                               const track_node track[]) {
     return (node - track);
@@ -208,9 +204,9 @@ int TrackGraph::shortest_path(const Marklin::sensor_t& start,
 
     const track_node* start_node = nullptr;
     const track_node* end_node = nullptr;
-    for (auto& n : track) {
-        if (node_is_sensor(n, start)) start_node = &n;
-        if (node_is_sensor(n, end)) end_node = &n;
+    for (size_t i = 0; i < TRACK_MAX; i++) {
+        if (node_is_sensor(track[i], start)) start_node = &track[i];
+        if (node_is_sensor(track[i], end)) end_node = &track[i];
     }
     assert(start_node != nullptr);
     assert(end_node != nullptr);
@@ -250,8 +246,7 @@ int TrackGraph::shortest_path(const Marklin::sensor_t& start,
         size_t num_edges = curr->type == NODE_BRANCH ? 2 : 1;
         for (size_t i = 0; i < num_edges; i++) {
             const track_edge& edge = curr->edge[i];
-            track_node* next = edge.dest;
-            size_t next_idx = index_of(next, track);
+            const size_t next_idx = edge.dest;
             assert(next_idx < TRACK_MAX);
 
             if (visited[next_idx]) continue;
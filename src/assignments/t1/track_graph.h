@@ -3,14 +3,18 @@
 #include <optional>
 
 #include "marklin.h"
-#include "track_data_new.h"
+#include "common/track_data.h"
 
 class TrackGraph {
-    track_node track[TRACK_MAX];
+    // one of the TrackData tables
+    const track_node* track;
 
    public:
     TrackGraph(Marklin::Track t);
 
+    /// Returns the node at the given index (e.g: a track_edge's dest).
+    const track_node& node(size_t idx) const { return track[idx]; }
+
     std::optional<int /* mm */> distance_between(
         const Marklin::sensor_t& old_sensor,
         const Marklin::sensor_t& new_sensor,
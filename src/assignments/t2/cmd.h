@@ -25,6 +25,7 @@ struct Command {
         Q,
         ROUTE,
         RV,
+        SENSORS,
         STOP,
         SW,
         TR,
@@ -46,6 +47,8 @@ struct Command {
             size_t no;
         } rv;
         struct {
+        } sensors;
+        struct {
         } stop;
         struct {
             size_t no;
@@ -1,5 +1,7 @@
 #include "marklin.h"
 
+#include <cstring>
+
 #include "user/debug.h"
 #include "user/syscalls.h"
 #include "user/tasks/clockserver.h"
@@ -7,36 +9,84 @@
 
 namespace Marklin {
 
-void Controller::send_go() const { Uart::Putc(uart, COM1, 0x60); }
-void Controller::send_stop() const { Uart::Putc(uart, COM1, 0x61); }
+void Controller::push(const char* cmd, size_t len, bool urgent_cmd) {
+    // A train command queued behind other commands joins their batch, rather
+    // than going on the urgent lane, where it would overtake them.
+    if (num_cmds > 0 && urgent && !urgent_cmd) commit();
+    if (num_cmds == 0) urgent = urgent_cmd;
+
+    if (batch_len + len > (urgent ? URGENT_BATCH_MAX : BATCH_MAX) ||
+        num_cmds == Uart::MAX_PUT_FRAMES) {
+        const bool batch_urgent = urgent;
+        commit();
+        urgent = batch_urgent;
+    }
+    memcpy(batch + batch_len, cmd, len);
+    batch_len += len;
+    cmd_lens[num_cmds++] = (uint8_t)len;
+}
+
+void Controller::send_go() {
+    const char cmd = 0x60;
+    push(&cmd, 1, false);
+}
 
-void Controller::update_train(TrainState tr) const {
-    Uart::Putc(uart, COM1, (char)tr.raw);
-    Uart::Putc(uart, COM1, (char)tr.no);
+// Speed changes jump ahead of any queued switch / sensor traffic, since a late
+// stop command directly translates into a train overshooting its target. Only
+// commands committed earlier are overtaken though: see update_train() in
+// marklin.h.
+void Controller::update_train(TrainState tr) {
+    const char cmd[2] = {(char)tr.raw, (char)tr.no};
+    push(cmd, 2, true);
 }
 
-void Controller::update_branch(uint8_t id, BranchDir dir) const {
-    Uart::Putc(uart, COM1, dir == BranchDir::Curved ? 0x22 : 0x21);
-    Uart::Putc(uart, COM1, (char)id);
-    Uart::Putc(uart, COM1, 0x20);
+void Controller::update_branch(uint8_t id, BranchDir dir) {
+    const char cmd[3] = {dir == BranchDir::Curved ? (char)0x22 : (char)0x21,
+                         (char)id, 0x20};
+    push(cmd, 3, false);
 }
 
-void Controller::update_branches(const BranchState* branches, size_t n) const {
-    for (size_t i = 0; i < n; i++) {
-        const BranchState& b = branches[i];
-        Uart::Putc(uart, COM1, b.dir == BranchDir::Curved ? 0x22 : 0x21);
-        Uart::Putc(uart, COM1, (char)b.no);
+void Controller::update_branches(const BranchMask& branches) {
+    for (uint8_t id : VALID_SWITCHES) {
+        const char cmd[2] = {
+            branches.get(id) == BranchDir::Curved ? (char)0x22 : (char)0x21,
+            (char)id};
+        push(cmd, 2, false);
     }
-    Uart::Putc(uart, COM1, 0x20);
+    const char solenoid_off = 0x20;
+    push(&solenoid_off, 1, false);
+}
+
+void Controller::commit() {
+    if (urgent) {
+        if (batch_len > 0)
+            Uart::Putn(uart, COM1, batch, batch_len, Uart::Lane::Urgent);
+    } else if (num_cmds > 0) {
+        Uart::PutFrames(uart, COM1, batch, cmd_lens, num_cmds);
+    }
+    batch_len = 0;
+    num_cmds = 0;
+}
+
+void Controller::send_sensor_query() {
+    const char cmd = (char)(128 + NUM_SENSOR_GROUPS);
+    push(&cmd, 1, false);
+    flush();
 }
 
-void Controller::query_sensors(char data[2 * NUM_SENSOR_GROUPS]) const {
-    Uart::Putc(uart, COM1, (char)(128 + NUM_SENSOR_GROUPS));
-    // TODO?: make this resilient against dropped bytes
-    Uart::Getn(uart, COM1, NUM_SENSOR_GROUPS * 2, data);
+bool Controller::read_sensors(char data[2 * NUM_SENSOR_GROUPS],
+                              uint64_t& first_byte_us,
+                              uint64_t& last_byte_us) {
+    if (Uart::Getn(uart, COM1, 1, data) < 0) return false;
+    first_byte_us = Clock::TimeUs();
+    if (Uart::Getn(uart, COM1, NUM_SENSOR_GROUPS * 2 - 1, data + 1) < 0)
+        return false;
+    last_byte_us = Clock::TimeUs();
+    return true;
 }
 
-void Controller::flush() const {
+void Controller::flush() {
+    commit();
     Uart::Flush(uart, COM1);
 }
 }
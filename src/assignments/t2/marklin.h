@@ -4,6 +4,9 @@
 #include <cstdint>
 #include <optional>
 
+#include "common/sensor_bitmap.h"
+#include "user/tasks/uartserver.h"
+
 /// Classes for interacting with the Marklin digital train controller.
 namespace Marklin {
 
@@ -11,47 +14,15 @@ constexpr uint8_t VALID_SWITCHES[] = {1,  2,  3,   4,   5,   6,  7,  8,
                                       9,  10, 11,  12,  13,  14, 15, 16,
                                       17, 18, 153, 154, 155, 156};
 constexpr uint8_t VALID_TRAINS[] = {1, 24, 58, 74, 78, 79};
-constexpr size_t NUM_SENSOR_GROUPS = 5;
+constexpr size_t NUM_SENSOR_GROUPS = SensorBitmap::NUM_GROUPS;
 
 enum class Track : char { A = 'A', B = 'B' };
 
 enum class BranchDir { Straight, Curved };
 
-/// Describes a particular track sensor
-struct sensor_t {
-    char group;
-    uint8_t idx;
-};
-
-inline bool sensor_eq(const sensor_t& a, const sensor_t& b) {
-    return a.group == b.group && a.idx == b.idx;
-}
-
-/// Wrapper around raw sensor data
-struct SensorData {
-    char raw[2 * NUM_SENSOR_GROUPS];
-
-    std::optional<sensor_t> next_sensor() {
-        for (size_t bi = 0; bi < NUM_SENSOR_GROUPS * 2; bi++) {
-            char& byte = raw[bi];
-            for (size_t i = 1; i <= 8; i++) {
-                bool active = (byte >> (8 - i)) & 0x01;
-                // disable the bit
-                byte &= (char)(~(0x01 << (8 - i)));
-
-                if (active) {
-                    char group = (char)((int)'A' + (bi / 2));
-                    uint8_t idx = (uint8_t)(i + (8 * (bi % 2)));
-
-                    const sensor_t s = {.group = group, .idx = idx};
-                    return s;
-                }
-            }
-        }
+using sensor_t = ::sensor_t;
 
-        return std::nullopt;
-    }
-};
+inline bool sensor_eq(const sensor_t& a, const sensor_t& b) { return a == b; }
 
 /// Describes a position on the track
 struct track_pos_t {
@@ -87,52 +58,118 @@ class TrainState {
     }
 };
 
-/// Describes the state of a particular branch (straight / curved)
-class BranchState {
-   private:
-    friend class Controller;
+constexpr size_t NUM_BRANCHES = sizeof(VALID_SWITCHES);
 
-    uint8_t no;
-    BranchDir dir;
+/// Maps a switch id onto a dense index in [0, NUM_BRANCHES), in the same order
+/// as VALID_SWITCHES. Returns -1 for invalid switch ids.
+constexpr int branch_index(uint8_t id) {
+    if (id >= 1 && id <= 18) return id - 1;
+    if (id >= 153 && id <= 156) return id - 153 + 18;
+    return -1;
+}
+
+static_assert(NUM_BRANCHES <= 32);
+
+/// The direction of every branch on the track, packed into a single word (one
+/// bit per branch, set if the branch is curved).
+class BranchMask {
+    uint32_t curved;
 
    public:
-    BranchState() = default;
-    BranchState(uint8_t id, BranchDir branch_dir) : no{id}, dir{branch_dir} {}
+    /// All branches start off curved.
+    BranchMask() : curved{(uint32_t)((1ull << NUM_BRANCHES) - 1)} {}
 
-    uint8_t get_id() const { return no; }
-    BranchDir get_dir() const { return dir; }
+    /// precondition: branch_index(id) >= 0
+    BranchDir get(uint8_t id) const {
+        return (curved >> branch_index(id)) & 1 ? BranchDir::Curved
+                                                : BranchDir::Straight;
+    }
 
-    void set_id(uint8_t id) { no = id; }
-    void set_dir(BranchDir branch_dir) { dir = branch_dir; }
+    /// precondition: branch_index(id) >= 0
+    void set(uint8_t id, BranchDir dir) {
+        const uint32_t bit = 1u << branch_index(id);
+        if (dir == BranchDir::Curved) {
+            curved |= bit;
+        } else {
+            curved &= ~bit;
+        }
+    }
+
+    bool operator==(const BranchMask& other) const {
+        return curved == other.curved;
+    }
 };
 
 /// High-level abstraction for interacting with the Marklin train controller
 /// via the UART controller.
+///
+/// Commands are accumulated in a batch, and are only sent to the UART server
+/// once `commit()` is called, in the order they were queued and in a single
+/// write. Each command goes out as its own frame, so a train command committed
+/// later (on the UART's urgent lane) can still cut in between, e.g. the switch
+/// commands of an earlier `update_branches()`.
 class Controller {
    private:
+    static constexpr size_t BATCH_MAX = 128;
+    static constexpr size_t URGENT_BATCH_MAX = 32;
+
     const int uart;
 
+    // Commands queued since the last commit, back to back. A batch is either
+    // all train commands (sent as one frame on the urgent lane), or starts
+    // with something else and is sent on the normal lane.
+    char batch[BATCH_MAX];
+    size_t batch_len;
+    uint8_t cmd_lens[Uart::MAX_PUT_FRAMES];
+    size_t num_cmds;
+    bool urgent;
+
+    void push(const char* cmd, size_t len, bool urgent_cmd);
+
    public:
     /// Construct a new MarklinUART.
-    Controller(int uart_tid) : uart{uart_tid} {}
-
-    /// Sends the Go command.
-    void send_go() const;
-    /// Sends the Emergency Stop command.
-    void send_stop() const;
-
-    /// Sends the commands to update a particular train's state.
-    void update_train(TrainState tr) const;
-    /// Sends the commands to update a particular branch.
-    void update_branch(uint8_t id, BranchDir dir) const;
-    /// Sends the commands to update a set of branches.
-    void update_branches(const BranchState* branches, size_t n) const;
-
-    /// Sends a sensor query command, blocking until the train set responds with
-    /// the sensor data.
-    void query_sensors(char data[2 * NUM_SENSOR_GROUPS]) const;
-
-    /// Block until the UART has finished sending any queued commands
-    void flush() const;
+    Controller(int uart_tid)
+        : uart{uart_tid},
+          batch{},
+          batch_len{0},
+          cmd_lens{},
+          num_cmds{0},
+          urgent{false} {}
+
+    /// Queues the Go command.
+    void send_go();
+
+    /// Queues the commands to update a particular train's state. These are
+    /// sent on the urgent lane, unless other commands have been queued since
+    /// the last commit: then they join that batch on the normal lane, so that
+    /// they can't overtake it (e.g. speed commands queued after `send_go()`).
+    /// Commit first if the train command must not wait behind the batch.
+    void update_train(TrainState tr);
+    /// Queues the commands to update a particular branch.
+    void update_branch(uint8_t id, BranchDir dir);
+    /// Queues the commands to update every branch on the track.
+    void update_branches(const BranchMask& branches);
+
+    /// Sends all queued commands to the UART server. A batch of nothing but
+    /// train commands is sent ahead of anything committed earlier; a train
+    /// command queued after any other command waits its turn behind it.
+    void commit();
+
+    /// Commits any queued commands along with a sensor query command, and
+    /// blocks until the query has gone out over the wire.
+    void send_sensor_query();
+
+    /// Blocks until the train set responds to a sensor query with the sensor
+    /// data. The Clock::TimeUs() at which the first and last bytes of the
+    /// response arrived are written to `first_byte_us` and `last_byte_us`.
+    ///
+    /// Returns false if the response was cut short (i.e: by a Uart::Drain).
+    [[nodiscard]] bool read_sensors(char data[2 * NUM_SENSOR_GROUPS],
+                                    uint64_t& first_byte_us,
+                                    uint64_t& last_byte_us);
+
+    /// Commits any queued commands, and blocks until the UART has finished
+    /// sending them.
+    void flush();
 };
 }  // namespace Marklin
@@ -0,0 +1,253 @@
+#include "route_planner.h"
+
+#include <algorithm>
+
+#include "user/debug.h"
+
+// Arc costs are scaled up, plus one for the arc itself, so that the cheapest
+// of several equally long routes is the one with the fewest arcs. This way
+// every arc costs something (even zero-length ones), so following the cheapest
+// arcs always leads to the goal, rather than around in circles.
+static constexpr int HOP_SCALE = 512;
+// Far more than any real route costs, while leaving plenty of headroom in a
+// key.
+static constexpr int INF = 1 << 29;
+// km only ever grows, so the search starts over well before it could overflow
+// a key.
+static constexpr int MAX_KM = 1 << 24;
+
+int RoutePlanner::arc_cost(const TrackGraph::arc_t& arc) {
+    return arc.cost * HOP_SCALE + 1;
+}
+
+inline static int add_cost(int g, int cost) {
+    return g >= INF ? INF : std::min(g + cost, INF);
+}
+
+RoutePlanner::RoutePlanner()
+    : graph{nullptr},
+      train{0},
+      reversal_penalty_mm{0},
+      goal{NO_NODE},
+      g{},
+      rhs{},
+      queued_key{},
+      queued{},
+      open{},
+      km{0},
+      last_start{NO_NODE},
+      seen_cost_epoch{0} {}
+
+void RoutePlanner::reset(const TrackGraph& track,
+                         uint8_t train,
+                         int reversal_penalty_mm,
+                         uint8_t goal,
+                         uint8_t start) {
+    this->graph = &track;
+    this->train = train;
+    this->reversal_penalty_mm = reversal_penalty_mm;
+    this->goal = goal;
+
+    for (size_t i = 0; i < TRACK_MAX; i++) {
+        g[i] = INF;
+        rhs[i] = INF;
+        queued[i] = false;
+    }
+    open = OpenQueue();
+    km = 0;
+    last_start = start;
+    seen_cost_epoch = track.cost_epoch;
+
+    rhs[goal] = 0;
+    push(goal, key_of(goal, start));
+}
+
+// Keys are ordered by estimated total cost, and then by cost to the goal.
+// Packing them into one integer lets them be compared in one go.
+int64_t RoutePlanner::key_of(uint8_t node, uint8_t start) const {
+    const int cost = std::min(g[node], rhs[node]);
+    // The lower bound is UINT16_MAX if node can't be reached from start, which
+    // keeps it from ever overestimating (unlike treating it as 0 would).
+    const int64_t estimate =
+        cost + graph->lower_bound(start, node) * HOP_SCALE + km;
+    return (estimate << 32) | cost;
+}
+
+void RoutePlanner::push(uint8_t node, int64_t key) {
+    queued[node] = true;
+    queued_key[node] = key;
+    if (open.push({.key = key, .node = node}, -key) == PriorityQueueErr::FULL)
+        rebuild_open();
+}
+
+// Replaces the open queue with one holding a single entry per queued node.
+void RoutePlanner::rebuild_open() {
+    open = OpenQueue();
+    for (size_t i = 0; i < TRACK_MAX; i++) {
+        if (!queued[i]) continue;
+        const PriorityQueueErr err = open.push(
+            {.key = queued_key[i], .node = (uint8_t)i}, -queued_key[i]);
+        assert(err == PriorityQueueErr::OK);
+    }
+}
+
+// Returns the open queue's lowest (live) key, dropping any stale entries above
+// it, or nullptr if the queue is empty.
+const RoutePlanner::open_entry_t* RoutePlanner::top() {
+    while (const open_entry_t* entry = open.peek()) {
+        if (queued[entry->node] && queued_key[entry->node] == entry->key)
+            return entry;
+        open.pop();
+    }
+    return nullptr;
+}
+
+// Recomputes rhs for `node`, and (re)queues it if it's inconsistent.
+void RoutePlanner::update_node(uint8_t node, uint8_t start) {
+    if (node != goal) {
+        TrackGraph::arc_t arcs[TrackGraph::MAX_ARCS];
+        const size_t n =
+            graph->successors(node, train, reversal_penalty_mm, arcs);
+        int best = INF;
+        for (size_t a = 0; a < n; a++) {
+            best =
+                std::min(best, add_cost(g[arcs[a].node], arc_cost(arcs[a])));
+        }
+        rhs[node] = best;
+    }
+    requeue(node, start);
+}
+
+// Queues `node` if it's inconsistent, or takes it out of the queue otherwise.
+void RoutePlanner::requeue(uint8_t node, uint8_t start) {
+    queued[node] = false;
+    if (g[node] != rhs[node]) push(node, key_of(node, start));
+}
+
+// Settles nodes until the cost from `start` to the goal is known.
+void RoutePlanner::compute(uint8_t start) {
+    while (const open_entry_t* entry = top()) {
+        if (entry->key >= key_of(start, start) && rhs[start] <= g[start])
+            break;
+
+        const uint8_t u = entry->node;
+        const int64_t old_key = entry->key;
+        open.pop();
+
+        // the start has moved closer to u since it was queued
+        const int64_t new_key = key_of(u, start);
+        if (old_key < new_key) {
+            push(u, new_key);
+            continue;
+        }
+
+        queued[u] = false;
+        TrackGraph::arc_t arcs[TrackGraph::MAX_ARCS];
+        const size_t n =
+            graph->predecessors(u, train, reversal_penalty_mm, arcs);
+        if (g[u] > rhs[u]) {
+            // u got cheaper, which can only make routes through it cheaper
+            g[u] = rhs[u];
+            for (size_t a = 0; a < n; a++) {
+                const uint8_t p = arcs[a].node;
+                const int alt = add_cost(g[u], arc_cost(arcs[a]));
+                if (p == goal || alt >= rhs[p]) continue;
+                rhs[p] = alt;
+                requeue(p, start);
+            }
+        } else {
+            // u got more expensive, so anything whose best route was through
+            // it needs another look
+            const int old_g = g[u];
+            g[u] = INF;
+            for (size_t a = 0; a < n; a++) {
+                const uint8_t p = arcs[a].node;
+                if (rhs[p] == add_cost(old_g, arc_cost(arcs[a])))
+                    update_node(p, start);
+            }
+            update_node(u, start);
+        }
+    }
+}
+
+int RoutePlanner::route(const TrackGraph& track,
+                        const Marklin::sensor_t& start_sensor,
+                        const Marklin::sensor_t& end_sensor,
+                        const track_node* path[],
+                        size_t max_path_len,
+                        size_t& distance,
+                        uint8_t train,
+                        int reversal_penalty_mm) {
+    const uint8_t start = track.node_of(start_sensor);
+    const uint8_t end = track.node_of(end_sensor);
+    assert(start < TRACK_MAX);
+    assert(end < TRACK_MAX);
+    assert(reversal_penalty_mm >= 0 || reversal_penalty_mm == NO_REVERSALS);
+
+    if (start == end) {
+        distance = 0;
+        return 0;
+    }
+
+    bool fresh = graph != &track || goal != end || this->train != train ||
+                 this->reversal_penalty_mm != reversal_penalty_mm;
+
+    // If the start has moved, every key in the queue is now overestimated by
+    // at most the distance it moved.
+    if (!fresh && start != last_start) {
+        const int moved = track.lower_bound(last_start, start);
+        if (moved == UINT16_MAX || km + moved * HOP_SCALE > MAX_KM) {
+            fresh = true;
+        } else {
+            km += moved * HOP_SCALE;
+            last_start = start;
+        }
+    }
+
+    // the graph's cost epoch can only go backwards if it has wrapped around
+    if (track.cost_epoch < seen_cost_epoch) fresh = true;
+
+    if (fresh) {
+        reset(track, train, reversal_penalty_mm, end, start);
+    } else if (track.cost_epoch != seen_cost_epoch) {
+        for (size_t i = 0; i < TRACK_MAX; i++) {
+            if (track.cost_changed_at[i] > seen_cost_epoch)
+                update_node((uint8_t)i, start);
+        }
+        seen_cost_epoch = track.cost_epoch;
+    }
+
+    compute(start);
+    if (rhs[start] >= INF) return -1;
+
+    // follow the cheapest arcs to the goal
+    size_t path_len = 0;
+    int length = 0;
+    for (uint8_t curr = start;;) {
+        if (path_len == max_path_len) {
+            panic("path too long (max_path_len=%u)", (unsigned)max_path_len);
+        }
+        path[path_len++] = &track.node(curr);
+        if (curr == goal) break;
+
+        TrackGraph::arc_t arcs[TrackGraph::MAX_ARCS];
+        const size_t n =
+            track.successors(curr, train, reversal_penalty_mm, arcs);
+        size_t best = n;
+        int best_cost = INF;
+        for (size_t a = 0; a < n; a++) {
+            const int cost = add_cost(g[arcs[a].node], arc_cost(arcs[a]));
+            if (cost < best_cost) {
+                best = a;
+                best_cost = cost;
+            }
+        }
+        if (best == n) panic("route: planner has no route from %u", curr);
+
+        length += arcs[best].length;
+        curr = arcs[best].node;
+    }
+
+    distance = (size_t)length;
+    return (int)path_len;
+}
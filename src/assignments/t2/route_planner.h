@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+
+#include "common/priority_queue.h"
+#include "track_graph.h"
+
+/// Plans a train's route to a fixed destination, and keeps it up to date as
+/// the train moves and the track around it is reserved and released (D* Lite,
+/// searching backwards from the destination).
+///
+/// Only the nodes whose costs are affected by a change are re-examined, so
+/// re-planning after a small change is much cheaper than a fresh
+/// TrackGraph::route. The planner starts over whenever it's asked for a route
+/// to a different destination (or for a different train).
+class RoutePlanner {
+    struct open_entry_t {
+        int64_t key;
+        uint8_t node;
+    };
+
+    // Nodes are pushed again whenever their key changes (rather than having
+    // their key updated in place), and stale entries are skipped when popped.
+    // If the queue fills up, it's rebuilt from scratch, which is why there's
+    // room for more than one entry per node.
+    using OpenQueue = PriorityQueue<open_entry_t, 2 * TRACK_MAX, int64_t>;
+
+    const TrackGraph* graph;
+    uint8_t train;
+    int reversal_penalty_mm;
+    uint8_t goal;
+
+    // g[i] is the cost of the best route from i to the goal found so far, and
+    // rhs[i] is what it should be, given g of i's successors. Nodes where the
+    // two differ are "inconsistent", and sit in the open queue.
+    int g[TRACK_MAX];
+    int rhs[TRACK_MAX];
+    // the key each node was last pushed with, if it's in the open queue
+    int64_t queued_key[TRACK_MAX];
+    bool queued[TRACK_MAX];
+    OpenQueue open;
+
+    // Keys are relative to the start, so when the start moves, this is added
+    // to new keys instead of re-keying every node in the queue.
+    int km;
+    uint8_t last_start;
+    // the graph's cost_epoch as of the last call
+    uint32_t seen_cost_epoch;
+
+    static int arc_cost(const TrackGraph::arc_t& arc);
+    void reset(const TrackGraph& track,
+               uint8_t train,
+               int reversal_penalty_mm,
+               uint8_t goal,
+               uint8_t start);
+    int64_t key_of(uint8_t node, uint8_t start) const;
+    void push(uint8_t node, int64_t key);
+    void rebuild_open();
+    const open_entry_t* top();
+    void update_node(uint8_t node, uint8_t start);
+    void requeue(uint8_t node, uint8_t start);
+    void compute(uint8_t start);
+
+   public:
+    RoutePlanner();
+
+    /// Same as TrackGraph::route, except that the search is picked up from
+    /// where the last call left off, if it was for the same graph,
+    /// destination, train, and penalty.
+    [[nodiscard]] int route(
+        const TrackGraph& track,
+        const Marklin::sensor_t& start,
+        const Marklin::sensor_t& end,
+        const track_node* path[],
+        size_t max_path_len,
+        size_t& distance,
+        uint8_t train = 0,
+        int reversal_penalty_mm = DEFAULT_REVERSAL_PENALTY_MM);
+};
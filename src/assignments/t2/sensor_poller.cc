@@ -0,0 +1,336 @@
+#include "sensor_poller.h"
+
+#include <algorithm>
+#include <cstring>
+#include <optional>
+
+#include "common/queue.h"
+#include "common/sensor_bitmap.h"
+#include "user/debug.h"
+#include "user/syscalls.h"
+#include "user/tasks/clockserver.h"
+#include "user/tasks/uartserver.h"
+
+namespace SensorPoller {
+
+const char* SERVER_ID = "SensorPoller";
+
+#define EVENT_RING_SIZE 128
+#define MAX_SUBSCRIBERS 8
+#define DUMP_LEN SensorBitmap::RAW_LEN
+#define WORKER_PRIORITY 1000
+// A dump normally takes ~70ms to arrive once the query has gone out...
+#define DUMP_TICKS 7
+// ...so if it hasn't arrived after this long, a byte has almost certainly been
+// dropped.
+#define DUMP_TIMEOUT_TICKS 25
+#define WATCHDOG_PERIOD_TICKS 5
+// There are never more than a handful of trains on the track, each of which
+// can only trigger a couple of sensors at a time.
+#define MAX_PLAUSIBLE_SENSORS 12
+
+struct Request {
+    enum { QuerySent, Dump, Await, Watchdog, Stats } tag;
+    union {
+        struct {
+            int time;
+        } query_sent;
+        struct {
+            // false if the dump was cut short, in which case `raw` is garbage
+            bool complete;
+            size_t stray_bytes;
+            char raw[DUMP_LEN];
+            uint64_t first_byte_us;
+            uint64_t last_byte_us;
+        } dump;
+        struct {
+            size_t cursor;
+        } await;
+        struct {
+            int time;
+        } watchdog;
+        struct {
+        } stats;
+    };
+};
+
+struct Response {
+    size_t cursor;
+    size_t n;
+    event_t events[MAX_EVENTS];
+};
+
+struct subscriber_t {
+    int tid;
+    size_t cursor;
+};
+
+// Discards everything in COM1's RX buffer. Uart::Drain only drops bytes that
+// have already arrived, so the rest of a dump that's still on its way is
+// waited out, and drained as well.
+static void drain_com1(int uart, int clock) {
+    Uart::Drain(uart, COM1);
+    Clock::Delay(clock, DUMP_TICKS);
+    Uart::Drain(uart, COM1);
+}
+
+/// Sits in a tight loop, dumping the sensors and forwarding the raw data to
+/// the server.
+static void PollerWorker() {
+    int server = MyParentTid();
+    assert(server >= 0);
+    int uart = WhoIs(Uart::COM1_SERVER_ID);
+    assert(uart >= 0);
+    int clock = WhoIs(Clock::SERVER_ID);
+    assert(clock >= 0);
+
+    Marklin::Controller marklin(uart);
+
+    Request sent = {.tag = Request::QuerySent, .query_sent = {.time = 0}};
+    Request req;
+    req.tag = Request::Dump;
+    // A complete dump is held back until the next query has gone out, so that
+    // any stray bytes trailing it have had a chance to show up.
+    bool holding = false;
+    bool resync = true;
+    while (true) {
+        if (resync) {
+            drain_com1(uart, clock);
+            holding = false;
+        }
+
+        marklin.send_sensor_query();
+
+        if (holding) {
+            // Nothing else reads from COM1, and the reply to the query that
+            // just went out can't have started arriving yet, so any bytes
+            // waiting now mean the held dump was misaligned. (A misaligned
+            // dump leaves every later dump misaligned too, so if the last
+            // stray byte is still on the wire, the next check will catch it.)
+            char stray[DUMP_LEN];
+            int n = Uart::TryGetn(uart, COM1, sizeof(stray), stray);
+            req.dump.stray_bytes = n > 0 ? (size_t)n : 0;
+            holding = false;
+            Send(server, (char*)&req, sizeof(req), (char*)&resync,
+                 sizeof(resync));
+            // the reply to the new query gets drained along with the rest
+            if (resync) continue;
+        }
+
+        sent.query_sent.time = Clock::Time(clock);
+        Send(server, (char*)&sent, sizeof(sent), nullptr, 0);
+
+        req.dump.complete = marklin.read_sensors(
+            req.dump.raw, req.dump.first_byte_us, req.dump.last_byte_us);
+        req.dump.stray_bytes = 0;
+        if (req.dump.complete) {
+            holding = true;
+        } else {
+            Send(server, (char*)&req, sizeof(req), (char*)&resync,
+                 sizeof(resync));
+        }
+    }
+}
+
+/// Periodically pokes the server, so it can notice when the worker gets stuck
+/// waiting on a dump that's never going to finish.
+static void DumpWatchdog() {
+    int server = MyParentTid();
+    assert(server >= 0);
+    int clock = WhoIs(Clock::SERVER_ID);
+    assert(clock >= 0);
+
+    Request req = {.tag = Request::Watchdog, .watchdog = {.time = 0}};
+    while (true) {
+        Clock::Delay(clock, WATCHDOG_PERIOD_TICKS);
+        req.watchdog.time = Clock::Time(clock);
+        Send(server, (char*)&req, sizeof(req), nullptr, 0);
+    }
+}
+
+/// Ring buffer of the most recent sensor events, indexed by a monotonically
+/// increasing sequence number.
+class EventLog {
+    event_t ring[EVENT_RING_SIZE];
+    size_t next_seq;
+
+   public:
+    EventLog() : ring{}, next_seq{0} {}
+
+    size_t end() const { return next_seq; }
+
+    void push(const event_t& e) { ring[next_seq++ % EVENT_RING_SIZE] = e; }
+
+    /// Copies the events starting at `cursor` into `res`, skipping past any
+    /// events which have already been overwritten.
+    void read(size_t cursor, Response& res) const {
+        if (next_seq - cursor > EVENT_RING_SIZE)
+            cursor = next_seq - EVENT_RING_SIZE;
+        res.n = std::min(next_seq - cursor, MAX_EVENTS);
+        for (size_t i = 0; i < res.n; i++)
+            res.events[i] = ring[(cursor + i) % EVENT_RING_SIZE];
+        res.cursor = cursor + res.n;
+    }
+};
+
+// Appends an event for each sensor which is set in the dump, but not in `prev`.
+static void log_rising_edges(EventLog& log,
+                             const SensorBitmap& prev,
+                             const SensorBitmap& curr,
+                             const Request& req) {
+    sensor_t rising[DUMP_LEN * 8];
+    size_t n = curr.rising_edges(prev).extract(rising, DUMP_LEN * 8);
+    for (size_t i = 0; i < n; i++) {
+        log.push({.sensor = rising[i],
+                  .first_byte_us = req.dump.first_byte_us,
+                  .last_byte_us = req.dump.last_byte_us});
+    }
+}
+
+static void reply_with_events(int tid, const EventLog& log, size_t cursor) {
+    Response res;
+    log.read(cursor, res);
+    Reply(tid, (char*)&res, sizeof(res));
+}
+
+void Server() {
+    int nsres = RegisterAs(SERVER_ID);
+    assert(nsres >= 0);
+
+    int uart = WhoIs(Uart::COM1_SERVER_ID);
+    assert(uart >= 0);
+
+    Create(WORKER_PRIORITY, PollerWorker);
+    Create(WORKER_PRIORITY, DumpWatchdog);
+
+    EventLog log;
+    Queue<subscriber_t, MAX_SUBSCRIBERS> subscribers;
+
+    stats_t stats = {.dumps = 0,
+                     .timeouts = 0,
+                     .misaligned = 0,
+                     .stray_bytes = 0,
+                     .implausible = 0};
+    // when the worker's outstanding query went out, if it has one
+    std::optional<int> query_sent_at;
+
+    // sensors which were already triggered when the poller started shouldn't
+    // be reported as events, so the first dump is only used as a baseline.
+    bool have_prev = false;
+    SensorBitmap prev;
+
+    int tid;
+    Request req;
+    while (true) {
+        int reqlen = Receive(&tid, (char*)&req, sizeof(req));
+        if (reqlen != sizeof(req))
+            panic("SensorPoller: bad request length %d", reqlen);
+
+        switch (req.tag) {
+            case Request::QuerySent: {
+                Reply(tid, nullptr, 0);
+                query_sent_at = req.query_sent.time;
+                break;
+            }
+            case Request::Dump: {
+                query_sent_at = std::nullopt;
+
+                // If the dump can't be trusted, the worker drains COM1 before
+                // its next query, and the next good dump becomes the new
+                // baseline (so that a garbage dump doesn't look like a burst
+                // of sensor events once things are back in sync).
+                bool resync = false;
+                SensorBitmap curr;
+                if (!req.dump.complete) {
+                    stats.timeouts++;
+                    resync = true;
+                } else if (req.dump.stray_bytes > 0) {
+                    stats.misaligned++;
+                    stats.stray_bytes += req.dump.stray_bytes;
+                    resync = true;
+                } else {
+                    stats.dumps++;
+                    curr = SensorBitmap::from_raw(req.dump.raw);
+                    sensor_t triggered[MAX_PLAUSIBLE_SENSORS + 1];
+                    if (curr.extract(triggered, MAX_PLAUSIBLE_SENSORS + 1) >
+                        MAX_PLAUSIBLE_SENSORS) {
+                        stats.implausible++;
+                        resync = true;
+                    }
+                }
+                Reply(tid, (char*)&resync, sizeof(resync));
+
+                if (resync) {
+                    have_prev = false;
+                    break;
+                }
+
+                const size_t old_end = log.end();
+                if (have_prev) log_rising_edges(log, prev, curr, req);
+                prev = curr;
+                have_prev = true;
+
+                // subscribers only ever block when they're caught up, so they
+                // all have something to read once any new event is logged.
+                if (log.end() == old_end) break;
+                while (auto sub = subscribers.pop_front()) {
+                    reply_with_events(sub.value().tid, log,
+                                      sub.value().cursor);
+                }
+                break;
+            }
+            case Request::Await: {
+                size_t cursor = req.await.cursor;
+                if (cursor == LATEST) cursor = log.end();
+                if (cursor < log.end()) {
+                    reply_with_events(tid, log, cursor);
+                    break;
+                }
+                auto err =
+                    subscribers.push_back({.tid = tid, .cursor = cursor});
+                if (err == QueueErr::FULL)
+                    panic("SensorPoller: too many blocked subscribers");
+                break;
+            }
+            case Request::Watchdog: {
+                Reply(tid, nullptr, 0);
+                // If the dump is long overdue, the worker is stuck waiting for
+                // bytes that were dropped. Draining COM1 kicks it out of its
+                // Getn (and it drains COM1 properly before its next query).
+                if (query_sent_at.has_value() &&
+                    req.watchdog.time - query_sent_at.value() >=
+                        DUMP_TIMEOUT_TICKS) {
+                    Uart::Drain(uart, COM1);
+                    query_sent_at = std::nullopt;
+                }
+                break;
+            }
+            case Request::Stats: {
+                Reply(tid, (char*)&stats, sizeof(stats));
+                break;
+            }
+            default:
+                panic("SensorPoller: unexpected request tag: %d", (int)req.tag);
+        }
+    }
+}
+
+size_t Await(int tid, size_t& cursor, event_t events[MAX_EVENTS]) {
+    Request req = {.tag = Request::Await, .await = {.cursor = cursor}};
+    Response res;
+    int n = Send(tid, (char*)&req, sizeof(req), (char*)&res, sizeof(res));
+    if (n != sizeof(res)) panic("SensorPoller: truncated response");
+    memcpy(events, res.events, res.n * sizeof(event_t));
+    cursor = res.cursor;
+    return res.n;
+}
+
+stats_t Stats(int tid) {
+    Request req = {.tag = Request::Stats, .stats = {}};
+    stats_t stats;
+    int n = Send(tid, (char*)&req, sizeof(req), (char*)&stats, sizeof(stats));
+    if (n != sizeof(stats)) panic("SensorPoller: truncated response");
+    return stats;
+}
+
+}  // namespace SensorPoller
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "marklin.h"
+
+/// Dedicated task which continuously dumps the Marklin's sensors, and hands out
+/// the sensors that were newly triggered since the previous dump to any
+/// subscribed tasks.
+namespace SensorPoller {
+
+extern const char* SERVER_ID;
+
+/// Max number of events returned from a single call to Await
+constexpr size_t MAX_EVENTS = 16;
+
+/// Pass as the cursor to Await to only receive events that haven't happened
+/// yet.
+constexpr size_t LATEST = SIZE_MAX;
+
+/// A sensor that went from untriggered to triggered between two consecutive
+/// sensor dumps.
+struct event_t {
+    Marklin::sensor_t sensor;
+    // Clock::TimeUs() timestamps of when the first and last byte of the dump
+    // that reported the sensor were received.
+    uint64_t first_byte_us;
+    uint64_t last_byte_us;
+};
+
+/// Counters describing how often the sensor dump stream had to be
+/// resynchronised.
+struct stats_t {
+    // dumps that were received in full
+    size_t dumps;
+    // dumps that never completed (i.e: a byte was dropped), and were abandoned
+    size_t timeouts;
+    // dumps that were followed by unexpected bytes, and were discarded
+    size_t misaligned;
+    // unexpected bytes found in the RX buffer after a dump
+    size_t stray_bytes;
+    // dumps with more sensors triggered than is physically plausible
+    size_t implausible;
+};
+
+void Server();
+
+/// Blocks until there are sensor events at or past `cursor`, copying up to
+/// MAX_EVENTS of them into `events`, and returning the number of events
+/// copied. `cursor` is advanced past the returned events.
+///
+/// Subscribers which fall too far behind will miss events.
+size_t Await(int tid, size_t& cursor, event_t events[MAX_EVENTS]);
+
+/// Returns the poller's resynchronisation counters.
+stats_t Stats(int tid);
+
+}  // namespace SensorPoller
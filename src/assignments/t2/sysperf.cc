@@ -19,7 +19,7 @@ void SysPerf::Task() {
     Reply(tid, nullptr, 0);
 
     int clock = WhoIs(Clock::SERVER_ID);
-    int uart = WhoIs(Uart::SERVER_ID);
+    int uart = WhoIs(Uart::COM2_SERVER_ID);
 
     assert(clock >= 0);
     assert(uart >= 0);
@@ -47,6 +47,6 @@ void SysPerf::Task() {
                      "CPU Usage (%02lu%%) %s" VT_SHOWCUR VT_RESTORE,
                      (100 - perf.idle_time_pct), outbuf);
 
-        Clock::Delay(clock, (int)100);
+        Clock::Periodic(clock, 100);
     }
 }
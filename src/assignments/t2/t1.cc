@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cctype>
 #include <cstdio>
 #include <cstring>
@@ -12,6 +13,7 @@
 #include "calibration.h"
 #include "cmd.h"
 #include "marklin.h"
+#include "sensor_poller.h"
 #include "sysperf.h"
 #include "track_graph.h"
 #include "track_oracle.h"
@@ -33,6 +35,7 @@ static inline void print_help(const int uart) {
         "  rv <train>             - reverse a train (MUST BE AT SPEED ZERO!)" ENDL
         "  n <sensor> <offset>    - print the position, normalized" ENDL
         "  path <sensor> <sensor> - calculate route between two sensors" ENDL
+        "  sensors                - print sensor polling statistics" ENDL
     );
     // clang-format on
 }
@@ -71,6 +74,19 @@ static inline bool is_valid_sensor(const Marklin::sensor_t& sensor) {
     return true;
 }
 
+// The train can only reverse while it's stopped, which for now means a route
+// can only reverse at its very start, and only if the train isn't moving.
+static bool can_drive_route(const TrackGraph& track_graph,
+                            const uint8_t route[],
+                            size_t len,
+                            bool stopped) {
+    for (size_t i = 0; i + 1 < len; i++) {
+        if (route[i + 1] != track_graph.node(route[i]).reverse) continue;
+        if (i != 0 || !stopped) return false;
+    }
+    return true;
+}
+
 static inline void wait_for_enter(const int uart) {
     char dummy;
     Ui::prompt_user(uart, &dummy, sizeof(dummy));
@@ -108,44 +124,43 @@ static void do_route_cmd(const int uart,
                 td.pos.sensor.group, td.pos.sensor.idx, sensor.group,
                 sensor.idx, cmd.offset);
 
-    // find the shortest path
-    constexpr size_t MAX_PATH_LEN = 64;  // 64 is overkill, but it's fine
-    const track_node* path[MAX_PATH_LEN];
+    // find the shortest path that's clear of other trains, and reserve it
+    uint8_t route[TrackOracle::MAX_ROUTE_LEN];
+    const track_node* path[TrackOracle::MAX_ROUTE_LEN];
     size_t total_path_distance = 0;
-    int path_len = 0;
-
-    path_len = track_graph.shortest_path(td.pos.sensor, sensor, path,
-                                         MAX_PATH_LEN, total_path_distance);
+    int path_len = track_oracle.reserve_route(train, sensor, route,
+                                              total_path_distance);
+    // if the best route reverses somewhere the train can't, settle for the
+    // best one that doesn't reverse at all
+    if (path_len >= 0 &&
+        !can_drive_route(track_graph, route, (size_t)path_len, td.speed == 0)) {
+        track_oracle.release_reservations(train);
+        path_len = track_oracle.reserve_route(
+            train, sensor, route, total_path_distance, false);
+    }
     if (path_len < 0) {
-        // that's okay, all this means is that we might be stopped at a terminal
-        // of the track. if our speed is zero, then we could try to reverse, and
-        // then route.
-        if (td.speed != 0) {
-            log_error(uart,
-                      "could not find path, even though the train was running "
-                      "(i.e: it's assumed to be in a loop)");
-            return;
+        log_error(uart, "could not find a path that's clear of other trains!");
+        return;
+    }
+    for (size_t i = 0; i < (size_t)path_len; i++)
+        path[i] = &track_graph.node(route[i]);
+
+    if (path_len >= 2 && path[1] == &track_graph.node(path[0]->reverse)) {
+        log_line(uart, "reverse at %s", path[0]->name);
+        if (!cmd.dry_run) {
+            track_oracle.reverse_train(train);
+            td_opt = track_oracle.query_train(train);
+            assert(td_opt.has_value());
         }
 
-        track_oracle.reverse_train(train);
-
-        td_opt = track_oracle.query_train(train);
-        assert(td_opt.has_value());
-        const train_descriptor_t& td = td_opt.value();
-
-        path_len = track_graph.shortest_path(td.pos.sensor, sensor, path,
-                                             MAX_PATH_LEN, total_path_distance);
-
-        if (path_len < 0) {
-            log_error(uart,
-                      "could not find path, even after reversing the train!");
-            return;
-        }
+        std::copy(path + 1, path + path_len, path);
+        path_len--;
     }
 
     // FIXME: handle zero-len paths
     if (path_len == 0) {
         log_error(uart, "zero len paths not supported :/");
+        track_oracle.release_reservations(train);
         return;
     }
 
@@ -184,19 +199,27 @@ static void do_route_cmd(const int uart,
 
                 std::optional<Marklin::BranchDir> dir = std::nullopt;
 
-                if (n.edge[DIR_STRAIGHT].dest == &next_n) {
+                const track_node* straight =
+                    &track_graph.node(n.edge[DIR_STRAIGHT].dest);
+                const track_node* curved =
+                    &track_graph.node(n.edge[DIR_CURVED].dest);
+
+                if (straight == &next_n) {
                     log_line(uart, "set branch %d to straight", n.num);
                     dir = Marklin::BranchDir::Straight;
-                } else if (n.edge[DIR_CURVED].dest == &next_n) {
+                } else if (curved == &next_n) {
                     log_line(uart, "set branch %d to curved", n.num);
                     dir = Marklin::BranchDir::Curved;
                 } else {
                     panic("branch doesn't lead to next node in path!");
                 }
 
-                if (!cmd.dry_run) {
-                    // switch the branch
-                    track_oracle.set_branch_dir((uint8_t)n.num, dir.value());
+                if (!cmd.dry_run &&
+                    !track_oracle.set_branch_dir((uint8_t)n.num, dir.value(),
+                                                 train)) {
+                    log_error(uart, "could not set branch %d!", n.num);
+                    track_oracle.release_reservations(train);
+                    return;
                 }
             } break;
             case NODE_MERGE: {
@@ -214,6 +237,7 @@ static void do_route_cmd(const int uart,
 
     if (cmd.dry_run) {
         log_warning(uart, "Found --dry-run flag, not actually routing...");
+        track_oracle.release_reservations(train);
         return;
     }
 
@@ -252,6 +276,7 @@ static void do_route_cmd(const int uart,
         if (!ok) {
             log_error(uart, "wake_at_pos for slow-down failed unexpectedly!");
             track_oracle.set_train_speed(train, 0);
+            track_oracle.release_reservations(train);
             return;
         }
     }
@@ -270,6 +295,7 @@ static void do_route_cmd(const int uart,
     if (!ok) {
         log_error(uart, "wake_at_pos for stop failed unexpectedly!");
         track_oracle.set_train_speed(train, 0);
+        track_oracle.release_reservations(train);
         return;
     }
 
@@ -280,6 +306,7 @@ static void do_route_cmd(const int uart,
     track_oracle.set_train_speed(train, 0);
 
     Clock::Delay(clock, Calibration::stopping_time(train, 8));
+    track_oracle.release_reservations(train);
     log_success(uart, "Stopped!");
 }
 
@@ -295,7 +322,7 @@ static void CmdTask() {
         assert(n == sizeof(cfg));
         Reply(tid, nullptr, 0);
     }
-    int uart = WhoIs(Uart::SERVER_ID);
+    int uart = WhoIs(Uart::COM2_SERVER_ID);
     int clock = WhoIs(Clock::SERVER_ID);
     assert(uart >= 0);
     assert(clock >= 0);
@@ -384,12 +411,30 @@ static void CmdTask() {
                 track_oracle.reverse_train((uint8_t)cmd.rv.no);
                 log_success(uart, "Manually reversed train %u", cmd.rv.no);
             } break;
+            case Command::SENSORS: {
+                int poller = WhoIs(SensorPoller::SERVER_ID);
+                if (poller < 0) {
+                    log_error(uart, "Sensor poller isn't running.");
+                    break;
+                }
+                SensorPoller::stats_t stats = SensorPoller::Stats(poller);
+                log_line(uart,
+                         "sensor dumps: %u ok, %u timed out, %u misaligned "
+                         "(%u stray bytes), %u implausible",
+                         stats.dumps, stats.timeouts, stats.misaligned,
+                         stats.stray_bytes, stats.implausible);
+            } break;
             case Command::STOP: {
                 // IMPROVEMENT: actually implement stop command
                 log_error(uart, "Invalid command.");
             } break;
             case Command::SW: {
-                track_oracle.set_branch_dir((uint8_t)cmd.sw.no, cmd.sw.dir);
+                if (!track_oracle.set_branch_dir((uint8_t)cmd.sw.no,
+                                                 cmd.sw.dir)) {
+                    log_error(uart, "Branch %u is reserved by a train.",
+                              cmd.sw.no);
+                    break;
+                }
                 log_success(uart, "Manually set branch %u to %s", cmd.sw.no,
                             cmd.sw.dir == Marklin::BranchDir::Straight
                                 ? "straight"
@@ -454,17 +499,27 @@ static void t1_main(int clock, int uart, const TermSize& term_size) {
         assert(n == 0);
     }
 
-    // This task is now the update_sensors task
+    int sensor_poller = Create(1000, SensorPoller::Server);
+    assert(sensor_poller >= 0);
+
+    // This task now forwards sensor events to the track oracle
+    size_t cursor = SensorPoller::LATEST;
+    SensorPoller::event_t events[SensorPoller::MAX_EVENTS];
     while (true) {
-        track_oracle.update_sensors();
+        size_t n = SensorPoller::Await(sensor_poller, cursor, events);
+        track_oracle.update_sensors(events, n);
     }
 }
 
 void FirstUserTask() {
     int clock = Create(1000, Clock::Server);
-    int uart = Create(1000, Uart::Server);
+    // Marklin I/O is latency sensitive, so COM1 gets its own server, running
+    // at a higher priority than the terminal's.
+    int marklin_uart = Create(1001, Uart::COM1Server);
+    int uart = Create(1000, Uart::COM2Server);
 
     assert(clock >= 0);
+    assert(marklin_uart >= 0);
     assert(uart >= 0);
 
     // clear the terminal
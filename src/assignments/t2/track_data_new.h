@@ -1,17 +0,0 @@
-/* THIS FILE IS GENERATED CODE -- DO NOT EDIT */
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-#include "track_node.h"
-
-// The track initialization functions expect an array of this size.
-#define TRACK_MAX 144
-
-void init_tracka(track_node* track);
-void init_trackb(track_node* track);
-
-#ifdef __cplusplus
-}
-#endif
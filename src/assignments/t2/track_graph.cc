@@ -1,84 +1,296 @@
 #include "track_graph.h"
 
+#include <algorithm>
 #include <climits>
+#include <cstdint>
+#include <tuple>
 
 #include "common/priority_queue.h"
 #include "user/debug.h"
 
 static constexpr size_t MAX_ITERS = 40;
+static constexpr uint16_t NO_ROUTE = UINT16_MAX;
+
+struct route_tables_t {
+    bool ready;
+    // dist[i][j] is the length of the shortest path from node i to node j (in
+    // mm), or NO_ROUTE if there isn't one.
+    uint16_t dist[TRACK_MAX][TRACK_MAX];
+    // next[i][j] is the index of the node after i on the shortest path from
+    // node i to node j.
+    uint8_t next[TRACK_MAX][TRACK_MAX];
+    // Like dist, except that trains may reverse for free. This never
+    // overestimates the cost of a route with reversals, so it serves as the
+    // A* heuristic in TrackGraph::route.
+    uint16_t lower_bound[TRACK_MAX][TRACK_MAX];
+};
+
+static_assert(TRACK_MAX <= UINT8_MAX);
+
+// One set of tables for each track. These are far too large to live on a
+// task's stack, and are identical for every TrackGraph of the same track.
+static route_tables_t ROUTES[2];
+
+static constexpr size_t num_edges(node_type type) {
+    switch (type) {
+        case NODE_NONE:
+        case NODE_EXIT:
+            return 0;
+        case NODE_BRANCH:
+            return 2;
+        default:
+            return 1;
+    }
+}
+
+// Returns the index of the edge out of `from` which leads to `to`, or -1.
+static constexpr int edge_between(const track_node track[],
+                                  size_t from,
+                                  size_t to) {
+    for (size_t e = 0; e < num_edges(track[from].type); e++) {
+        if (track[from].edge[e].dest == to) return (int)e;
+    }
+    return -1;
+}
+
+// The fields of a track's node table that graph walks actually use, packed
+// into parallel arrays. A whole track fits in ~1.4KB (vs ~4.5KB for the
+// track_node table), so walks and searches only touch a few cache lines.
+// Names and the like are left in the (cold) TrackData table.
+struct compact_track_t {
+    // dest[e][i] and dist[e][i] describe node i's e'th edge
+    uint8_t dest[2][TRACK_MAX];
+    uint16_t dist[2][TRACK_MAX];
+    uint8_t reverse[TRACK_MAX];
+    // The same stretch of track as node i's e'th edge, travelled the other
+    // way, is edge rev_edge[e][i] out of node reverse[dest[e][i]].
+    uint8_t rev_edge[2][TRACK_MAX];
+    // node_type in the high byte, num in the low byte
+    uint16_t type_num[TRACK_MAX];
+    // sensor number ((group - 'A') * 16 + (idx - 1)) -> node index. (The
+    // inverse mapping is free, since sensor nodes store their number.)
+    uint8_t sensor_nodes[NUM_SENSORS];
+
+    constexpr compact_track_t(const track_node track[])
+        : dest{}, dist{}, reverse{}, rev_edge{}, type_num{}, sensor_nodes{} {
+        for (uint8_t& n : sensor_nodes) n = NO_NODE;
+        for (size_t i = 0; i < TRACK_MAX; i++) {
+            for (size_t e = 0; e < 2; e++) {
+                dest[e][i] = track[i].edge[e].dest;
+                dist[e][i] = (uint16_t)track[i].edge[e].dist;
+            }
+            reverse[i] = track[i].reverse;
+            type_num[i] = (uint16_t)((track[i].type << 8) | track[i].num);
+            if (track[i].type == NODE_SENSOR)
+                sensor_nodes[track[i].num] = (uint8_t)i;
+            for (size_t e = 0; e < ::num_edges(track[i].type); e++) {
+                const track_node& to = track[track[i].edge[e].dest];
+                rev_edge[e][i] =
+                    (uint8_t)edge_between(track, to.reverse, track[i].reverse);
+            }
+        }
+    }
+
+    node_type type(size_t i) const { return (node_type)(type_num[i] >> 8); }
+    uint8_t num(size_t i) const { return (uint8_t)type_num[i]; }
+
+    size_t num_edges(size_t i) const { return ::num_edges(type(i)); }
+};
+
+static constexpr bool fits_compact_track(const track_node track[]) {
+    for (size_t i = 0; i < TRACK_MAX; i++) {
+        if (track[i].num < 0 || track[i].num > UINT8_MAX) return false;
+        for (const track_edge& e : track[i].edge) {
+            if (e.dist < 0 || e.dist >= NO_ROUTE) return false;
+        }
+        // every edge must have a reverse
+        for (size_t e = 0; e < num_edges(track[i].type); e++) {
+            const track_node& to = track[track[i].edge[e].dest];
+            if (edge_between(track, to.reverse, track[i].reverse) < 0)
+                return false;
+        }
+    }
+    return true;
+}
+
+static_assert(fits_compact_track(TrackData::TRACKA));
+static_assert(fits_compact_track(TrackData::TRACKB));
+
+static constexpr compact_track_t COMPACT_TRACKS[2] = {
+    compact_track_t(TrackData::TRACKA), compact_track_t(TrackData::TRACKB)};
+
+// Floyd-Warshall over `dist`, which starts out holding the edge weights. If
+// `next` is non-null, it's kept up to date with the first hop of each path.
+static void floyd_warshall(uint16_t dist[TRACK_MAX][TRACK_MAX],
+                           uint8_t (*next)[TRACK_MAX]) {
+    for (size_t k = 0; k < TRACK_MAX; k++) {
+        for (size_t i = 0; i < TRACK_MAX; i++) {
+            const uint16_t ik = dist[i][k];
+            if (ik == NO_ROUTE) continue;
+            for (size_t j = 0; j < TRACK_MAX; j++) {
+                const uint16_t kj = dist[k][j];
+                if (kj == NO_ROUTE) continue;
+                const int alt = ik + kj;
+                if (alt < dist[i][j]) {
+                    assert(alt < NO_ROUTE);
+                    dist[i][j] = (uint16_t)alt;
+                    if (next != nullptr) next[i][j] = next[i][k];
+                }
+            }
+        }
+    }
+}
+
+// Run once per track at boot. O(V^3), but V is small, and it means that
+// routing rarely has to search the graph.
+static void compute_routes(const compact_track_t& track, route_tables_t& r) {
+    for (size_t i = 0; i < TRACK_MAX; i++) {
+        for (size_t j = 0; j < TRACK_MAX; j++) {
+            r.dist[i][j] = NO_ROUTE;
+            r.next[i][j] = (uint8_t)j;
+        }
+        r.dist[i][i] = 0;
+    }
+
+    for (size_t i = 0; i < TRACK_MAX; i++) {
+        for (size_t e = 0; e < track.num_edges(i); e++) {
+            const size_t j = track.dest[e][i];
+            assert(j < TRACK_MAX);
+            r.dist[i][j] = std::min(r.dist[i][j], track.dist[e][i]);
+        }
+    }
+
+    // the lower bounds start out with the same edges, plus a free edge from
+    // each node to its reverse.
+    for (size_t i = 0; i < TRACK_MAX; i++) {
+        for (size_t j = 0; j < TRACK_MAX; j++)
+            r.lower_bound[i][j] = r.dist[i][j];
+        if (track.type(i) != NODE_NONE)
+            r.lower_bound[i][track.reverse[i]] = 0;
+    }
+
+    floyd_warshall(r.dist, r.next);
+    floyd_warshall(r.lower_bound, nullptr);
+
+    r.ready = true;
+}
 
 TrackGraph::TrackGraph(Marklin::Track t) {
+    size_t tables_idx = 0;
     switch (t) {
         case Marklin::Track::A:
-            init_tracka(track);
+            track = TrackData::TRACKA;
+            tables_idx = 0;
             break;
         case Marklin::Track::B:
-            init_trackb(track);
+            track = TrackData::TRACKB;
+            tables_idx = 1;
             break;
         default:
             assert(false);
     }
+
+    compact = &COMPACT_TRACKS[tables_idx];
+    route_tables_t& tables = ROUTES[tables_idx];
+    if (!tables.ready) compute_routes(*compact, tables);
+    routes = &tables;
+
+    epoch = 1;
+    for (auto& e : next_sensor_cache) e.epoch = 0;
+    for (auto& e : distance_cache) e.epoch = 0;
+
+    for (auto& owners : edge_owner) {
+        for (uint8_t& owner : owners) owner = 0;
+    }
+    for (uint8_t& owner : switch_owner) owner = 0;
+    cost_epoch = 0;
+    for (uint32_t& at : cost_changed_at) at = 0;
 }
 
-inline static bool node_is_sensor(const track_node& node,
-                                  const Marklin::sensor_t& sensor) {
-    return node.type == NODE_SENSOR &&
-           node.num == (sensor.group - 'A') * 16 + (sensor.idx - 1);
+bool TrackGraph::set_branch_dir(uint8_t id, Marklin::BranchDir dir) {
+    if (Marklin::branch_index(id) < 0) return false;
+    if (branches.get(id) != dir) {
+        branches.set(id, dir);
+        bump_epoch();
+    }
+    return true;
 }
 
-// precondition: node.type == NODE_SENSOR
-inline static Marklin::sensor_t sensor_of_node(const track_node& node) {
-    return {.group = (char)('A' + (node.num / 16)),
-            .idx = (uint8_t)(node.num % 16 + 1)};
+void TrackGraph::set_branches(const Marklin::BranchMask& mask) {
+    if (branches == mask) return;
+    branches = mask;
+    bump_epoch();
 }
 
-// precondition: branch.type == NODE_BRANCH
-Marklin::BranchDir TrackGraph::branch_dir(const track_node& branch) const {
-    assert(branch.type == NODE_BRANCH);
-    for (auto& b : branches) {
-        if (b.get_id() == branch.num) {
-            return b.get_dir();
-        }
-    }
-    panic("TrackGraph::branch_dir: unkown direction for branch %d", branch.num);
+void TrackGraph::bump_epoch() {
+    // epoch 0 marks a cache entry as empty
+    if (++epoch == 0) epoch = 1;
 }
 
-const track_edge* TrackGraph::next_edge(const track_node& node) const {
-    switch (node.type) {
+// Returns NO_NODE if there's no such sensor on the track.
+uint8_t TrackGraph::node_of(const Marklin::sensor_t& sensor) const {
+    const size_t num = (size_t)((sensor.group - 'A') * 16 + (sensor.idx - 1));
+    if (sensor.idx < 1 || sensor.idx > 16 || num >= NUM_SENSORS) return NO_NODE;
+    return compact->sensor_nodes[num];
+}
+
+inline static Marklin::sensor_t sensor_of_num(uint8_t num) {
+    return {.group = (char)('A' + (num / 16)), .idx = (uint8_t)(num % 16 + 1)};
+}
+
+// precondition: node i is a NODE_BRANCH
+Marklin::BranchDir TrackGraph::branch_dir(size_t i) const {
+    assert(compact->type(i) == NODE_BRANCH);
+    assert(Marklin::branch_index(compact->num(i)) >= 0);
+    return branches.get(compact->num(i));
+}
+
+int TrackGraph::next_edge(size_t i) const {
+    switch (compact->type(i)) {
         case NODE_NONE:
         case NODE_EXIT:
-            return nullptr;
+            return -1;
         case NODE_BRANCH:
-            switch (branch_dir(node)) {
+            switch (branch_dir(i)) {
                 case Marklin::BranchDir::Straight:
-                    return &node.edge[0];
+                    return DIR_STRAIGHT;
                 case Marklin::BranchDir::Curved:
-                    return &node.edge[1];
+                    return DIR_CURVED;
                 default:
-                    assert(false);
+                    panic("unknown branch direction %d", (int)branch_dir(i));
             }
         default:
-            auto edge = &node.edge[0];
-            assert(edge != 0);
-            return edge;
+            return DIR_AHEAD;
     }
 }
 
 std::optional<std::pair<Marklin::sensor_t, int>> TrackGraph::next_sensor(
     const Marklin::sensor_t& sensor) const {
-    const track_node* curr = nullptr;
-    for (auto& node : track) {
-        if (node_is_sensor(node, sensor)) curr = &node;
+    const uint8_t node = node_of(sensor);
+    if (node == NO_NODE) return std::nullopt;
+
+    next_sensor_cache_t& cached = next_sensor_cache[compact->num(node)];
+    if (cached.epoch != epoch) {
+        auto res = next_sensor_uncached(node);
+        cached = {.epoch = epoch,
+                  .found = res.has_value(),
+                  .sensor = res.has_value() ? res->first : sensor,
+                  .distance = res.has_value() ? res->second : 0};
     }
-    if (curr == nullptr) return std::nullopt;
+    if (!cached.found) return std::nullopt;
+    return std::make_pair(cached.sensor, cached.distance);
+}
+
+std::optional<std::pair<Marklin::sensor_t, int>>
+TrackGraph::next_sensor_uncached(uint8_t curr) const {
     int distance = 0;
     while (true) {
-        auto edge = next_edge(*curr);
-        if (edge == nullptr) return std::nullopt;
-        distance += edge->dist;
-        curr = edge->dest;
-        if (curr->type == NODE_SENSOR)
-            return std::make_pair(sensor_of_node(*curr), distance);
+        const int e = next_edge(curr);
+        if (e < 0) return std::nullopt;
+        distance += compact->dist[e][curr];
+        curr = compact->dest[e][curr];
+        if (compact->type(curr) == NODE_SENSOR)
+            return std::make_pair(sensor_of_num(compact->num(curr)), distance);
     }
 }
 
@@ -87,55 +299,86 @@ std::optional<int> TrackGraph::distance_between(
     const Marklin::sensor_t& new_sensor) const {
     debug("distance_between(%c%hhu %c%hhu)", old_sensor.group, old_sensor.idx,
           new_sensor.group, new_sensor.idx);
-    const track_node* start = nullptr;
-    const track_node* end = nullptr;
-    for (auto& node : track) {
-        if (node_is_sensor(node, old_sensor)) start = &node;
-        if (node_is_sensor(node, new_sensor)) end = &node;
-    }
-    assert(start != nullptr);
-    assert(end != nullptr);
+    const uint8_t start = node_of(old_sensor);
+    const uint8_t end = node_of(new_sensor);
+    assert(start != NO_NODE);
+    assert(end != NO_NODE);
 
     if (start == end) return 0;
 
+    const uint8_t start_num = compact->num(start);
+    const uint8_t end_num = compact->num(end);
+    distance_cache_t& cached =
+        distance_cache[(start_num * 31u + end_num) % DISTANCE_CACHE_SIZE];
+    if (cached.epoch != epoch || cached.start != start_num ||
+        cached.end != end_num) {
+        auto res = distance_between_uncached(start, end);
+        cached = {.epoch = epoch,
+                  .start = start_num,
+                  .end = end_num,
+                  .found = res.has_value(),
+                  .distance = res.value_or(0)};
+    }
+    if (!cached.found) return std::nullopt;
+    return cached.distance;
+}
+
+std::optional<int> TrackGraph::distance_between_uncached(uint8_t start,
+                                                          uint8_t end) const {
+    if (routes->dist[start][end] == NO_ROUTE) return std::nullopt;
+
+    // If the current branch state already routes along the shortest path, the
+    // answer is right there in the table.
+    {
+        bool branches_match = true;
+        for (size_t i = start; i != end;) {
+            const size_t next = routes->next[i][end];
+            if (compact->type(i) == NODE_BRANCH &&
+                compact->dest[next_edge(i)][i] != next) {
+                branches_match = false;
+                break;
+            }
+            i = next;
+        }
+        if (branches_match) return routes->dist[start][end];
+    }
+
     int distance = 0;
-    const track_node* curr = start;
+    uint8_t curr = start;
     for (size_t i = 0; curr != end; i++) {
         if (i > MAX_ITERS) return std::nullopt;
-        const track_edge* edge = next_edge(*curr);
-        if (edge == nullptr) {
+        const int e = next_edge(curr);
+        if (e < 0) {
             // we've run out of track - there's no path to new_sensor given the
             // current track state.
             return std::nullopt;
         }
-        debug("  %s->%s: %dmm", curr->name, edge->dest->name, edge->dist);
-        curr = edge->dest;
-        distance += edge->dist;
+        debug("  %s->%s: %dmm", track[curr].name,
+              track[compact->dest[e][curr]].name, compact->dist[e][curr]);
+        distance += compact->dist[e][curr];
+        curr = compact->dest[e][curr];
 
         if (curr == start) {
             // we've hit a cycle, and we'll never reach new_sensor
             return std::nullopt;
         }
     }
-    debug("distance_between(%c%hhu %c%hhu) = %dmm", old_sensor.group,
-          old_sensor.idx, new_sensor.group, new_sensor.idx, distance);
+    debug("distance_between(%s %s) = %dmm", track[start].name, track[end].name,
+          distance);
     return distance;
 }
 
 Marklin::sensor_t TrackGraph::invert_sensor(
     const Marklin::sensor_t& sensor) const {
-    const track_node* node = nullptr;
-    for (auto& n : track) {
-        if (node_is_sensor(n, sensor)) node = &n;
-    }
-    if (node == nullptr) panic("unknown sensor %c%u", sensor.group, sensor.idx);
-    return sensor_of_node(*node->reverse);
+    const uint8_t node = node_of(sensor);
+    if (node == NO_NODE) panic("unknown sensor %c%u", sensor.group, sensor.idx);
+    return sensor_of_num(compact->num(compact->reverse[node]));
 }
 
 std::optional<std::pair<Marklin::sensor_t, int /* distance, mm */>>
 TrackGraph::prev_sensor(const Marklin::sensor_t& sensor) const {
     auto prev_sensor_inv_opt =
-        next_sensor(invert_sensor(sensor), branches, BRANCHES_LEN);
+        next_sensor(invert_sensor(sensor));
     if (!prev_sensor_inv_opt.has_value()) return std::nullopt;
     auto [prev_sensor_inv, distance] = prev_sensor_inv_opt.value();
     return std::make_pair(invert_sensor(prev_sensor_inv), distance);
@@ -167,124 +410,347 @@ Marklin::track_pos_t TrackGraph::normalize(
     }
 }
 
-struct search_node_t {
-    track_node* node;
-    int total_distance;
-};
-
-static inline size_t index_of(const track_node* node,
-                              const track_node track[]) {
-    return (node - track);
-}
-
-// Run Dijkstra's Algorithm on the track graph, based on this implementation:
-// https://en.wikipedia.org/wiki/Dijkstra%27s_algorithm#Pseudocode
+// Walks the precomputed next-hop table from start to end.
 int TrackGraph::shortest_path(const Marklin::sensor_t& start,
                               const Marklin::sensor_t& end,
                               const track_node* path[],
                               size_t max_path_len,
                               size_t& distance) const {
-    int dist[TRACK_MAX];
-    bool visited[TRACK_MAX];
-    const track_node* prev[TRACK_MAX];
-    for (size_t i = 0; i < TRACK_MAX; i++) {
-        dist[i] = INT_MAX;
-        visited[i] = false;
-        prev[i] = nullptr;
+    const size_t start_idx = node_of(start);
+    const size_t end_idx = node_of(end);
+    assert(start_idx < TRACK_MAX);
+    assert(end_idx < TRACK_MAX);
+
+    if (start_idx == end_idx) {
+        distance = 0;
+        return 0;
     }
 
-    const track_node* start_node = nullptr;
-    const track_node* end_node = nullptr;
-    for (auto& n : track) {
-        if (node_is_sensor(n, start)) start_node = &n;
-        if (node_is_sensor(n, end)) end_node = &n;
+    if (routes->dist[start_idx][end_idx] == NO_ROUTE) return -1;
+
+    size_t path_len = 0;
+    for (size_t i = start_idx;; i = routes->next[i][end_idx]) {
+        if (path_len == max_path_len) {
+            panic("path too long (max_path_len=%u)", (unsigned)max_path_len);
+        }
+        path[path_len++] = &track[i];
+        if (i == end_idx) break;
     }
-    assert(start_node != nullptr);
-    assert(end_node != nullptr);
-    const size_t start_idx = index_of(start_node, track);
-    const size_t end_idx = index_of(end_node, track);
+
+    distance = routes->dist[start_idx][end_idx];
+
+    return (int)path_len;
+}
+
+// A* over the track graph, where every node also has an edge to its reverse
+// (costing `reversal_penalty_mm`). Using a consistent heuristic means each
+// node is expanded at most once, so the search is bounded by the size of the
+// track.
+int TrackGraph::route(const Marklin::sensor_t& start,
+                      const Marklin::sensor_t& end,
+                      const track_node* path[],
+                      size_t max_path_len,
+                      size_t& distance,
+                      uint8_t train,
+                      int reversal_penalty_mm) const {
+    const size_t start_idx = node_of(start);
+    const size_t end_idx = node_of(end);
     assert(start_idx < TRACK_MAX);
     assert(end_idx < TRACK_MAX);
+    assert(reversal_penalty_mm >= 0 || reversal_penalty_mm == NO_REVERSALS);
 
-    if (start_node == end_node) {
+    if (start_idx == end_idx) {
         distance = 0;
         return 0;
     }
 
-    dist[start_idx] = 0;
+    const uint16_t* h = &routes->lower_bound[0][end_idx];
+    auto heuristic = [&](size_t i) { return h[i * TRACK_MAX]; };
+    if (heuristic(start_idx) == NO_ROUTE) return -1;
 
-    bool found = false;
-    while (true) {
-        int min_dist = INT_MAX;
-        const track_node* curr = nullptr;
-        for (size_t i = 0; i < TRACK_MAX; i++) {
-            const track_node& node = track[i];
-            assert(index_of(&node, track) == i);
-            if (!visited[i] && dist[i] < min_dist && node.type != NODE_NONE &&
-                node.type != NODE_EXIT) {
-                curr = &node;
-                min_dist = dist[i];
-            }
-        }
-        if (curr == nullptr) break;
-        if (curr == end_node) {
-            found = true;
-            break;
-        }
-        const size_t curr_idx = index_of(curr, track);
-        visited[curr_idx] = true;
-
-        size_t num_edges = curr->type == NODE_BRANCH ? 2 : 1;
-        for (size_t i = 0; i < num_edges; i++) {
-            const track_edge& edge = curr->edge[i];
-            track_node* next = edge.dest;
-            size_t next_idx = index_of(next, track);
-            assert(next_idx < TRACK_MAX);
-
-            if (visited[next_idx]) continue;
-
-            int alt_dist = std::min(dist[next_idx], dist[curr_idx] + edge.dist);
-            if (alt_dist < dist[next_idx]) {
-                dist[next_idx] = alt_dist;
-                prev[next_idx] = curr;
-            }
+    // cost includes reversal penalties, length is the physical distance.
+    int cost[TRACK_MAX];
+    int length[TRACK_MAX];
+    uint8_t prev[TRACK_MAX];
+    bool closed[TRACK_MAX];
+    for (size_t i = 0; i < TRACK_MAX; i++) {
+        cost[i] = INT_MAX;
+        prev[i] = NO_NODE;
+        closed[i] = false;
+    }
+
+    // Nodes are pushed again whenever a cheaper path to them turns up (rather
+    // than having their priority updated in place), and stale entries are
+    // skipped when popped.
+    PriorityQueue<uint8_t, MAX_ROUTE_FRONTIER> open;
+    cost[start_idx] = 0;
+    length[start_idx] = 0;
+    open.push((uint8_t)start_idx, -(int)heuristic(start_idx));
+
+    while (auto next = open.pop()) {
+        const size_t u = next.value();
+        if (closed[u]) continue;
+        closed[u] = true;
+        if (u == end_idx) break;
+
+        arc_t arcs[MAX_ARCS];
+        const size_t num_arcs =
+            successors(u, train, reversal_penalty_mm, arcs);
+        for (size_t a = 0; a < num_arcs; a++) {
+            const size_t v = arcs[a].node;
+            if (closed[v] || heuristic(v) == NO_ROUTE) continue;
+            const int alt = cost[u] + arcs[a].cost;
+            if (alt >= cost[v]) continue;
+            cost[v] = alt;
+            length[v] = length[u] + arcs[a].length;
+            prev[v] = (uint8_t)u;
+            if (open.push((uint8_t)v, -(alt + heuristic(v))) ==
+                PriorityQueueErr::FULL)
+                panic("route: search frontier overflowed");
         }
     }
 
-    if (!found) {
-        assert(prev[end_idx] == nullptr);
-        return -1;
+    if (!closed[end_idx]) return -1;
+
+    size_t path_len = 1;
+    for (size_t i = end_idx; i != start_idx; i = prev[i]) path_len++;
+    if (path_len > max_path_len) {
+        panic("path too long (max_path_len=%u)", (unsigned)max_path_len);
+    }
+    size_t n = path_len;
+    for (size_t i = end_idx;; i = prev[i]) {
+        path[--n] = &track[i];
+        if (i == start_idx) break;
     }
 
-    assert(prev[end_idx] != nullptr);
+    distance = (size_t)length[end_idx];
+    return (int)path_len;
+}
 
-    int path_len = 1;
-    {
-        const track_node* curr = end_node;
-        while (curr != start_node) {
-            size_t curr_idx = index_of(curr, track);
-            assert(curr_idx < TRACK_MAX);
-            curr = prev[curr_idx];
-            assert(curr != nullptr);
-            path_len++;
+size_t TrackGraph::successors(size_t node,
+                              uint8_t train,
+                              int reversal_penalty_mm,
+                              arc_t out[MAX_ARCS]) const {
+    size_t n = 0;
+    for (size_t e = 0; e < compact->num_edges(node); e++) {
+        if (train != 0 && !can_reserve(train, node, e)) continue;
+        const int dist = compact->dist[e][node];
+        out[n++] = {
+            .node = compact->dest[e][node], .cost = dist, .length = dist};
+    }
+    if (reversal_penalty_mm != NO_REVERSALS) {
+        out[n++] = {.node = compact->reverse[node],
+                    .cost = reversal_penalty_mm,
+                    .length = 0};
+    }
+    return n;
+}
+
+// The track arcs into a node are the reverses of the arcs out of its reverse.
+size_t TrackGraph::predecessors(size_t node,
+                                uint8_t train,
+                                int reversal_penalty_mm,
+                                arc_t out[MAX_ARCS]) const {
+    size_t n = 0;
+    const size_t rev = compact->reverse[node];
+    for (size_t e = 0; e < compact->num_edges(rev); e++) {
+        const size_t from = compact->reverse[compact->dest[e][rev]];
+        if (train != 0 && !can_reserve(train, from, compact->rev_edge[e][rev]))
+            continue;
+        const int dist = compact->dist[e][rev];
+        out[n++] = {.node = (uint8_t)from, .cost = dist, .length = dist};
+    }
+    if (reversal_penalty_mm != NO_REVERSALS) {
+        out[n++] = {
+            .node = (uint8_t)rev, .cost = reversal_penalty_mm, .length = 0};
+    }
+    return n;
+}
+
+int TrackGraph::lower_bound(size_t from, size_t to) const {
+    return routes->lower_bound[from][to];
+}
+
+// ------------------------------ Reservations ------------------------------ //
+
+// A train reserves the track ahead of it before moving onto it, so at a merge
+// it has come through, it holds the leg it came along. The switch only says
+// which leg it came along if the train doesn't hold exactly one of them (e.g:
+// it was placed on the track there).
+int TrackGraph::trailing_edge(size_t node, uint8_t train) const {
+    if (compact->type(node) != NODE_BRANCH) return next_edge(node);
+    const bool held_straight = edge_owner[DIR_STRAIGHT][node] == train;
+    const bool held_curved = edge_owner[DIR_CURVED][node] == train;
+    if (held_straight != held_curved)
+        return held_straight ? DIR_STRAIGHT : DIR_CURVED;
+    return next_edge(node);
+}
+
+// Writes the switches that a train on node `node`'s e'th edge might be sitting
+// on (either end of the edge can be a branch) into `out`, as indices into
+// switch_owner. Returns the number of switches written.
+size_t TrackGraph::switches_of(size_t node, size_t e, size_t out[2]) const {
+    size_t n = 0;
+    const size_t rev_src = compact->reverse[compact->dest[e][node]];
+    for (size_t from : {node, rev_src}) {
+        if (compact->type(from) != NODE_BRANCH) continue;
+        const int idx = Marklin::branch_index(compact->num(from));
+        assert(idx >= 0);
+        out[n++] = (size_t)idx;
+    }
+    return n;
+}
+
+bool TrackGraph::can_reserve(uint8_t train, size_t node, size_t e) const {
+    const uint8_t owner = edge_owner[e][node];
+    if (owner != 0 && owner != train) return false;
+    size_t switches[2];
+    const size_t n = switches_of(node, e, switches);
+    for (size_t i = 0; i < n; i++) {
+        const uint8_t sw_owner = switch_owner[switches[i]];
+        if (sw_owner != 0 && sw_owner != train) return false;
+    }
+    return true;
+}
+
+// precondition: can_reserve(train, node, e)
+void TrackGraph::reserve_edge(uint8_t train, size_t node, size_t e) {
+    const size_t rev_src = compact->reverse[compact->dest[e][node]];
+    set_edge_owner(node, e, train);
+    for (size_t from : {node, rev_src}) {
+        if (compact->type(from) == NODE_BRANCH) set_switch_owner(from, train);
+    }
+}
+
+void TrackGraph::release_edge(size_t node, size_t e) {
+    const uint8_t train = edge_owner[e][node];
+    const size_t rev_src = compact->reverse[compact->dest[e][node]];
+    set_edge_owner(node, e, 0);
+
+    // the train keeps a switch for as long as it holds either of its legs
+    for (size_t from : {node, rev_src}) {
+        if (compact->type(from) != NODE_BRANCH) continue;
+        if (edge_owner[0][from] == train || edge_owner[1][from] == train)
+            continue;
+        const int idx = Marklin::branch_index(compact->num(from));
+        if (switch_owner[idx] == train) set_switch_owner(from, 0);
+    }
+}
+
+// Sets the owner of an edge (and its reverse).
+void TrackGraph::set_edge_owner(size_t node, size_t e, uint8_t train) {
+    if (edge_owner[e][node] == train) return;
+    const size_t rev_src = compact->reverse[compact->dest[e][node]];
+    edge_owner[e][node] = train;
+    edge_owner[compact->rev_edge[e][node]][rev_src] = train;
+    mark_cost_change(node);
+    mark_cost_change(rev_src);
+}
+
+// Sets the owner of the switch at the given branch node.
+void TrackGraph::set_switch_owner(size_t branch, uint8_t train) {
+    const int idx = Marklin::branch_index(compact->num(branch));
+    assert(idx >= 0);
+    if (switch_owner[idx] == train) return;
+    switch_owner[idx] = train;
+
+    // A switch is checked for both of the edges leaving it, and for the edges
+    // that lead back into its points from the other side.
+    mark_cost_change(branch);
+    for (size_t e = 0; e < 2; e++)
+        mark_cost_change(compact->reverse[compact->dest[e][branch]]);
+}
+
+void TrackGraph::mark_cost_change(size_t node) {
+    cost_changed_at[node] = ++cost_epoch;
+}
+
+bool TrackGraph::reserve_path(uint8_t train,
+                              const track_node* const path[],
+                              size_t len) {
+    assert(train != 0);
+    for (int pass = 0; pass < 2; pass++) {
+        for (size_t i = 0; i + 1 < len; i++) {
+            const size_t from = index_of(path[i]);
+            const size_t to = index_of(path[i + 1]);
+            if (to == compact->reverse[from]) continue;  // reversing
+            int e = -1;
+            for (size_t j = 0; j < compact->num_edges(from); j++) {
+                if (compact->dest[j][from] == to) e = (int)j;
+            }
+            assert(e >= 0);
+            // check everything before reserving anything
+            if (pass == 0 && !can_reserve(train, from, (size_t)e)) return false;
+            if (pass == 1) reserve_edge(train, from, (size_t)e);
         }
     }
+    return true;
+}
 
-    if ((size_t)path_len > max_path_len) {
-        panic("path_len %d too large (max_path_len=%u)", path_len,
-              max_path_len);
+bool TrackGraph::reserve_footprint(uint8_t train,
+                                   const Marklin::track_pos_t& pos,
+                                   int tail_mm,
+                                   int lookahead_mm) {
+    assert(train != 0);
+    const uint8_t start = node_of(pos.sensor);
+    assert(start != NO_NODE);
+
+    // walk forwards from the sensor to past the train's nose, and then
+    // backwards from the sensor to the train's tail
+    const int ahead_mm = pos.offset_mm + lookahead_mm;
+    const int behind_mm = tail_mm - pos.offset_mm;
+    for (auto [from, remaining, forwards] :
+         {std::make_tuple(start, ahead_mm, true),
+          std::make_tuple(compact->reverse[start], behind_mm, false)}) {
+        uint8_t curr = from;
+        for (size_t i = 0; remaining > 0 && i < MAX_ITERS; i++) {
+            const int e =
+                forwards ? next_edge(curr) : trailing_edge(curr, train);
+            if (e < 0) break;
+            if (!can_reserve(train, curr, (size_t)e)) return false;
+            reserve_edge(train, curr, (size_t)e);
+            remaining -= compact->dist[e][curr];
+            curr = compact->dest[e][curr];
+        }
     }
+    return true;
+}
 
-    const track_node* curr = end_node;
-    size_t i = path_len - 1;
-    while (curr != start_node) {
-        path[i] = curr;
-        curr = prev[index_of(curr, track)];
-        i--;
+void TrackGraph::release_behind(uint8_t train,
+                                const Marklin::track_pos_t& pos,
+                                int tail_mm) {
+    const uint8_t start = node_of(pos.sensor);
+    assert(start != NO_NODE);
+
+    // skip past the edges that the train's tail is still on, and then release
+    // edges until we find one that the train doesn't hold.
+    int keep_mm = tail_mm - pos.offset_mm;
+    uint8_t curr = compact->reverse[start];
+    for (size_t i = 0; i < MAX_ITERS; i++) {
+        const int e = trailing_edge(curr, train);
+        if (e < 0) break;
+        if (keep_mm <= 0) {
+            if (edge_owner[e][curr] != train) break;
+            release_edge(curr, (size_t)e);
+        }
+        keep_mm -= compact->dist[e][curr];
+        curr = compact->dest[e][curr];
     }
-    path[0] = start_node;
+}
 
-    distance = (size_t)dist[end_idx];
+void TrackGraph::release_all(uint8_t train) {
+    for (size_t i = 0; i < TRACK_MAX; i++) {
+        for (size_t e = 0; e < compact->num_edges(i); e++) {
+            if (edge_owner[e][i] == train) set_edge_owner(i, e, 0);
+        }
+        if (compact->type(i) == NODE_BRANCH &&
+            switch_owner[Marklin::branch_index(compact->num(i))] == train)
+            set_switch_owner(i, 0);
+    }
+}
 
-    return (int)path_len;
+uint8_t TrackGraph::switch_reserved_by(uint8_t id) const {
+    const int idx = Marklin::branch_index(id);
+    if (idx < 0) return 0;
+    return switch_owner[idx];
 }
@@ -1,22 +1,141 @@
 #pragma once
 
 #include <optional>
+#include <utility>
 
 #include "marklin.h"
-#include "track_data_new.h"
+#include "common/track_data.h"
 
-static constexpr size_t BRANCHES_LEN = sizeof(Marklin::VALID_SWITCHES);
+static constexpr size_t NUM_SENSORS = Marklin::NUM_SENSOR_GROUPS * 16;
+static constexpr size_t DISTANCE_CACHE_SIZE = 64;
+static constexpr uint8_t NO_NODE = UINT8_MAX;
+// Each node is expanded at most once, and each edge out of it pushes at most
+// one node. There are at most three such edges (two branch edges + a reversal).
+static constexpr size_t MAX_ROUTE_FRONTIER = 3 * TRACK_MAX + 1;
+/// Roughly what it costs (in mm of travel) to stop, reverse, and get back up
+/// to speed.
+static constexpr int DEFAULT_REVERSAL_PENALTY_MM = 1000;
+/// A reversal penalty which rules out reversing altogether.
+static constexpr int NO_REVERSALS = -1;
+
+/// All-pairs shortest path tables for a track, ignoring branch state.
+struct route_tables_t;
+/// Compact copy of a track's node table, used for graph walks.
+struct compact_track_t;
 
 class TrackGraph {
-    track_node track[TRACK_MAX];
-    Marklin::BranchState branches[BRANCHES_LEN];
+    // one of the TrackData tables (only needed for names, and for handing
+    // out paths)
+    const track_node* track;
+    const compact_track_t* compact;
+    Marklin::BranchMask branches;
+    const route_tables_t* routes;
+
+    // Bumped whenever a branch changes direction. Cached results from an
+    // older epoch are stale.
+    uint32_t epoch;
+
+    struct next_sensor_cache_t {
+        uint32_t epoch;
+        bool found;
+        Marklin::sensor_t sensor;
+        int distance;
+    };
+    struct distance_cache_t {
+        uint32_t epoch;
+        uint8_t start;
+        uint8_t end;
+        bool found;
+        int distance;
+    };
+    // indexed by sensor number
+    mutable next_sensor_cache_t next_sensor_cache[NUM_SENSORS];
+    // direct-mapped, indexed by a hash of the (start, end) sensor numbers
+    mutable distance_cache_t distance_cache[DISTANCE_CACHE_SIZE];
+
+    // The train holding each edge (indexed like a node's edges, i.e:
+    // edge_owner[e][node]), or 0 if it's free. An edge and its reverse are
+    // always held together.
+    uint8_t edge_owner[2][TRACK_MAX];
+    // The train holding each switch (indexed by Marklin::branch_index), or 0.
+    // A switch is held along with any edge that touches its points, so that it
+    // can't be thrown under a train.
+    uint8_t switch_owner[Marklin::NUM_BRANCHES];
+
+    // Bumped whenever a node's outgoing edges are reserved or released (and so
+    // might now cost more or less to route over), with the node stamped with
+    // the new value. RoutePlanner compares these against the last value it saw
+    // to find the parts of its routes that need repairing.
+    uint32_t cost_epoch;
+    uint32_t cost_changed_at[TRACK_MAX];
+
+    // An edge in the graph that routes are planned over: either a stretch of
+    // track, or a reversal (from a node to its reverse).
+    struct arc_t {
+        uint8_t node;
+        // in mm, including any reversal penalty
+        int cost;
+        // in mm, actually travelled
+        int length;
+    };
+    static constexpr size_t MAX_ARCS = 3;
+
+    friend class RoutePlanner;
+
+    void bump_epoch();
 
-    Marklin::BranchDir branch_dir(const track_node& branch) const;
-    const track_edge* next_edge(const track_node& node) const;
+    std::optional<int> distance_between_uncached(uint8_t start,
+                                                 uint8_t end) const;
+    std::optional<std::pair<Marklin::sensor_t, int>> next_sensor_uncached(
+        uint8_t node) const;
+
+    uint8_t node_of(const Marklin::sensor_t& sensor) const;
+    Marklin::BranchDir branch_dir(size_t node) const;
+    // Returns the index of the edge that a train at `node` will take, or -1
+    // if it's the end of the line.
+    int next_edge(size_t node) const;
+    // Returns the index of the edge that leads back the way `train` came, when
+    // walking backwards from it through `node` (which is facing backwards), or
+    // -1 if it's the end of the line.
+    int trailing_edge(size_t node, uint8_t train) const;
+
+    size_t switches_of(size_t node, size_t e, size_t out[2]) const;
+    bool can_reserve(uint8_t train, size_t node, size_t e) const;
+    void reserve_edge(uint8_t train, size_t node, size_t e);
+    void release_edge(size_t node, size_t e);
+    void set_edge_owner(size_t node, size_t e, uint8_t train);
+    void set_switch_owner(size_t branch, uint8_t train);
+    void mark_cost_change(size_t node);
+
+    // The arcs out of / into `node` that `train` may use (all of them, if
+    // `train` is 0). Returns the number of arcs written to `out`.
+    size_t successors(size_t node,
+                      uint8_t train,
+                      int reversal_penalty_mm,
+                      arc_t out[MAX_ARCS]) const;
+    size_t predecessors(size_t node,
+                        uint8_t train,
+                        int reversal_penalty_mm,
+                        arc_t out[MAX_ARCS]) const;
+    // A lower bound on the cost of any route from `from` to `to`, or
+    // UINT16_MAX if there isn't one.
+    int lower_bound(size_t from, size_t to) const;
 
    public:
     TrackGraph(Marklin::Track t);
 
+    /// Returns the node at the given index (e.g: a track_edge's dest).
+    const track_node& node(size_t idx) const { return track[idx]; }
+    /// Inverse of node()
+    uint8_t index_of(const track_node* n) const { return (uint8_t)(n - track); }
+
+    /// Update the direction of a branch. Returns false if the branch doesn't
+    /// exist.
+    bool set_branch_dir(uint8_t id, Marklin::BranchDir dir);
+    /// Update the direction of every branch at once.
+    void set_branches(const Marklin::BranchMask& mask);
+    const Marklin::BranchMask& get_branches() const { return branches; }
+
     std::optional<int /* mm */> distance_between(
         const Marklin::sensor_t& old_sensor,
         const Marklin::sensor_t& new_sensor) const;
@@ -35,4 +154,55 @@ class TrackGraph {
                                     const track_node* path[],
                                     size_t max_path_len,
                                     size_t& distance) const;
+
+    /// Finds the cheapest route from start to end, which (unlike
+    /// shortest_path) may include reversing the train, at a cost of
+    /// `reversal_penalty_mm` per reversal (or not at all, if it's
+    /// NO_REVERSALS). A reversal appears in `path` as a node immediately
+    /// followed by its reverse.
+    ///
+    /// If `train` is non-zero, the route avoids any track reserved by other
+    /// trains.
+    ///
+    /// Returns the number of nodes in the path, or -1 if there's no route.
+    /// `distance` is set to the distance travelled, excluding any penalties.
+    ///
+    /// Trains are routed with a RoutePlanner, which repairs its last search
+    /// instead of starting over. This plain A* search is kept as the reference
+    /// that the planner is tested (and benchmarked) against.
+    [[nodiscard]] int route(
+        const Marklin::sensor_t& start,
+        const Marklin::sensor_t& end,
+        const track_node* path[],
+        size_t max_path_len,
+        size_t& distance,
+        uint8_t train = 0,
+        int reversal_penalty_mm = DEFAULT_REVERSAL_PENALTY_MM) const;
+
+    // Reservations: a train may only travel over track that it has reserved.
+    // Trains are identified by their (non-zero) id.
+
+    /// Reserves every edge along `path` (as returned by route()) for `train`.
+    /// If another train holds any of it, nothing is reserved, and false is
+    /// returned.
+    [[nodiscard]] bool reserve_path(uint8_t train,
+                                    const track_node* const path[],
+                                    size_t len);
+    /// Reserves the track under a train at `pos` (from `tail_mm` behind it),
+    /// plus `lookahead_mm` of the track ahead of it. Ahead of the train, this
+    /// follows the current branch state; behind it, it follows the track the
+    /// train came along. Returns false if another train holds any of it (in
+    /// which case only the track up to the conflict is reserved).
+    [[nodiscard]] bool reserve_footprint(uint8_t train,
+                                         const Marklin::track_pos_t& pos,
+                                         int tail_mm,
+                                         int lookahead_mm);
+    /// Releases the track that a train at `pos` has left behind it.
+    void release_behind(uint8_t train,
+                        const Marklin::track_pos_t& pos,
+                        int tail_mm);
+    /// Releases everything held by `train`.
+    void release_all(uint8_t train);
+    /// Returns the train holding the given switch, or 0 if it's free.
+    uint8_t switch_reserved_by(uint8_t id) const;
 };
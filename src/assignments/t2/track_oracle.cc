@@ -1,10 +1,14 @@
 #include "track_oracle.h"
 #include "track_graph.h"
 
+#include <algorithm>
 #include <climits>
+#include <cstddef>
+#include <cstdlib>
 #include <cstring>
 #include <optional>
 
+#include "common/queue.h"
 #include "common/vt_escapes.h"
 #include "user/debug.h"
 #include "user/syscalls.h"
@@ -12,6 +16,8 @@
 #include "user/tasks/uartserver.h"
 
 #include "calibration.h"
+#include "route_planner.h"
+#include "sensor_poller.h"
 #include "ui.h"
 
 // ------------------------ TrackOracleTask Plumbing ------------------------ //
@@ -23,6 +29,8 @@ enum class MsgTag {
     Normalize,
     QueryBranch,
     QueryTrain,
+    ReleaseReservations,
+    ReserveRoute,
     ReverseTrain,
     SetBranchDir,
     SetTrainLight,
@@ -30,6 +38,12 @@ enum class MsgTag {
     Tick,
     UpdateSensors,
     WakeAtPos,
+    WakeupTimer,
+};
+
+struct sensor_events_t {
+    size_t n;
+    SensorPoller::event_t events[SensorPoller::MAX_EVENTS];
 };
 
 struct Req {
@@ -42,13 +56,18 @@ struct Req {
         struct { uint8_t id; uint8_t speed; }            set_train_speed;
         struct { uint8_t id; bool active; }              set_train_light;
         struct { uint8_t id; }                           reverse_train;
-        struct { uint8_t id; Marklin::BranchDir dir; }   set_branch_dir;
+        struct { uint8_t id; Marklin::BranchDir dir;
+                 uint8_t train; }                        set_branch_dir;
         struct { uint8_t id; }                           query_train;
         struct { uint8_t id; }                           query_branch;
-        struct {}                                        update_sensors;
+        struct { uint8_t id; Marklin::sensor_t dest;
+                 bool allow_reversals; }                 reserve_route;
+        struct { uint8_t id; }                           release_reservations;
+        sensor_events_t                                  update_sensors;
         struct {}                                        tick;
         struct {}                                        make_loop;
         Marklin::track_pos_t                             normalize;
+        struct {}                                        wakeup_timer;
         // clang-format on
     };
 };
@@ -63,41 +82,98 @@ struct Res {
         struct { bool success; } set_train_speed;
         struct { bool success; } set_train_light;
         struct { bool success; } reverse_train;
-        struct {} set_branch_dir;
+        struct { bool success; } set_branch_dir;
         struct {} update_sensors;
         struct { bool valid; train_descriptor_t desc; } query_train;
         struct { Marklin::BranchDir dir; } query_branch;
         Marklin::track_pos_t normalize;
         struct {} make_loop;
+        struct { int len; size_t distance;
+                 uint8_t path[TrackOracle::MAX_ROUTE_LEN]; } reserve_route;
+        struct {} release_reservations;
+        struct { int deadline; } wakeup_timer;
         // clang-format on
     };
 };
 
 static constexpr size_t MAX_TRAINS = 6;
-static constexpr size_t BRANCHES_LEN = sizeof(Marklin::VALID_SWITCHES);
+// Route executors, switch throwers, stop controllers, etc. can all be waiting
+// on the same train at once.
+static constexpr size_t MAX_WAKEUPS = 4 * MAX_TRAINS;
+// Each task that's due to be woken before the next tick gets a courier of its
+// own, so that it's woken on time. Any beyond this are woken on the next tick.
+static constexpr size_t NUM_WAKEUP_COURIERS = 4;
 static const char* TRACK_ORACLE_TASK_ID = "TRACK_ORACLE";
 
+// How far a train extends behind the point where it triggers a sensor
+static constexpr int TRAIN_TAIL_MM = 300;
+// Extra track that's reserved past a train's stopping distance, to cover for
+// the slop in our position and velocity estimates.
+static constexpr int LOOKAHEAD_MARGIN_MM = 200;
+// How many sensors past a train's last one a sensor event can be attributed
+// to it (i.e: up to ATTRIBUTION_LOOKAHEAD - 1 sensors in a row can be missed).
+static constexpr size_t ATTRIBUTION_LOOKAHEAD = 3;
+// The smallest gap between where a train is predicted to be and a sensor that
+// will still be put down to the train.
+static constexpr int ATTRIBUTION_WINDOW_MM = 250;
+
 // EWMA with alpha = 1/4
 inline static int ewma4(int curr, int obs) { return (3 * curr + obs) / 4; }
 
+/// A train which is waiting to hit its first sensor, so that its position can
+/// be determined.
+struct calibration_t {
+    int tid;
+    train_descriptor_t* train;
+    uint8_t id;
+    // the tick at which the train will have stopped, and can be sent off to
+    // find a sensor, or -1 once it's been sent off
+    int start_at;
+};
+
 /// Associates a tid with a position on the track that it should be woken up at
 struct wakeup_t {
     int tid;
     uint8_t train;
     Marklin::track_pos_t pos;
+    // the tick at which the train is predicted to reach pos (INT_MAX if it's
+    // stopped)
+    int eta;
+    // the tick that a wakeup courier has been armed to fire at for this task,
+    // or -1
+    int timer_at;
+};
+
+/// Where a train has been routed to.
+struct route_goal_t {
+    Marklin::sensor_t dest;
+    int reversal_penalty_mm;
+    // false once the train has been cut off from dest (so that it's only
+    // warned about once)
+    bool reachable;
 };
 
 class TrackOracleImpl {
    private:
-    const TrackGraph track;
+    TrackGraph track;
     const int uart;
     const int clock;
-    const Marklin::Controller marklin;
+    Marklin::Controller marklin;
 
     train_descriptor_t trains[MAX_TRAINS];
+    // planners[i] plans trains[i]'s routes
+    RoutePlanner planners[MAX_TRAINS];
+    // route_goals[i] is where trains[i] is being routed to, if anywhere
+    std::optional<route_goal_t> route_goals[MAX_TRAINS];
+
+    // only one train can be calibrated at a time
+    std::optional<calibration_t> calibrating;
 
-    // TODO: support more than one blocked task
-    std::optional<wakeup_t> blocked_task;
+    // tasks blocked on wake_at_pos, soonest predicted arrival first
+    wakeup_t wakeups[MAX_WAKEUPS];
+    size_t num_wakeups;
+    // wakeup couriers that are blocked waiting to be armed
+    Queue<int, NUM_WAKEUP_COURIERS> idle_couriers;
 
     int last_ticked_at;
     int max_tick_delay;
@@ -111,118 +187,254 @@ class TrackOracleImpl {
         return nullptr;
     }
 
-    train_descriptor_t* attribute_sensor(Marklin::sensor_t sensor) {
-        // TODO base this off of how far the sensor is from our prediction of
-        // where each train is
-        (void)sensor;
+    /// Works out which train triggered a sensor at tick `now`, by comparing
+    /// each train's predicted position with the sensors just ahead of its last
+    /// known position. Returns nullptr if the sensor isn't anywhere near where
+    /// any train is expected to be.
+    ///
+    /// Only the first few sensors past each train are considered, so the cost
+    /// is bounded by MAX_TRAINS * ATTRIBUTION_LOOKAHEAD (cached) lookups.
+    train_descriptor_t* attribute_sensor(Marklin::sensor_t sensor, int now) {
+        train_descriptor_t* best = nullptr;
+        // the best match's error and window, compared as error / window
+        int64_t best_error = 1;
+        int64_t best_window = 0;
 
         for (train_descriptor_t& t : trains) {
             if (t.id == 0) continue;
 
-            // check to see if the train's last sensor was this sensor
+            // how far past its last known position the train should be by now
+            const int dt = std::max(now - t.pos_observed_at, 0);
+            const int travelled_mm = t.velocity * dt / TICKS_PER_SEC;
+
+            // Our velocity estimate is only so good, so the further the train
+            // has to go, the less sure we are of where it is. The error we saw
+            // at its last sensor is a good hint of how far off it'll be this
+            // time around.
+            int window_mm = ATTRIBUTION_WINDOW_MM + travelled_mm / 4;
+            if (t.has_error) window_mm += std::abs(t.distance_error);
+            // velocities are just interpolated while accelerating
+            if (t.accelerating) window_mm += travelled_mm / 2;
+
+            // The train keeps a sensor triggered for as long as it's over it,
+            // so its last sensor matches anywhere along the train's length.
+            int error_mm = -1;
             if (Marklin::sensor_eq(t.pos.sensor, sensor)) {
-                return &t;
-            }
-
-            // check to see if the next sensor is this sensor
-            if (Marklin::sensor_eq(t.next_sensor, sensor)) {
-                return &t;
-            }
-
-            // wait, maybe we missed a sensor!
-            auto next_sensor_opt =
-                track.next_sensor(t.next_sensor, branches, BRANCHES_LEN);
-
-            if (next_sensor_opt.has_value()) {
-                auto [next_sensor, _] = next_sensor_opt.value();
-                if (Marklin::sensor_eq(sensor, next_sensor)) {
-                    return &t;
+                error_mm = std::max(
+                    travelled_mm + t.pos.offset_mm - TRAIN_TAIL_MM, 0);
+            } else {
+                Marklin::sensor_t next = t.pos.sensor;
+                int distance_mm = -t.pos.offset_mm;
+                for (size_t i = 0; i < ATTRIBUTION_LOOKAHEAD; i++) {
+                    auto next_sensor_opt = track.next_sensor(next);
+                    if (!next_sensor_opt.has_value()) break;
+                    next = next_sensor_opt.value().first;
+                    distance_mm += next_sensor_opt.value().second;
+                    if (Marklin::sensor_eq(next, sensor)) {
+                        error_mm = std::abs(distance_mm - travelled_mm);
+                        break;
+                    }
                 }
             }
-
-            // otherwise, it's not this one...
+            if (error_mm < 0 || error_mm > window_mm) continue;
+
+            // prefer whichever train is closest relative to its window
+            if (best == nullptr ||
+                (int64_t)error_mm * best_window < best_error * window_mm) {
+                best = &t;
+                best_error = error_mm;
+                best_window = window_mm;
+            }
         }
-        return nullptr;
+        return best;
     }
 
     std::optional<int> distance_between(
         const Marklin::track_pos_t& old_pos,
         const Marklin::track_pos_t& new_pos) const {
-        auto distance_opt = track.distance_between(
-            old_pos.sensor, new_pos.sensor, this->branches, BRANCHES_LEN);
+        auto distance_opt =
+            track.distance_between(old_pos.sensor, new_pos.sensor);
         if (!distance_opt.has_value()) return std::nullopt;
         return distance_opt.value() + (new_pos.offset_mm - old_pos.offset_mm);
     }
 
+    /// Reserves the track under a train, along with enough of the track ahead
+    /// of it that it could stop before running out of reserved track (even if
+    /// it misses its next sensor report), and releases the track it has left
+    /// behind. If the track ahead is held by another train, the train is
+    /// stopped.
+    void update_footprint(train_descriptor_t& td) {
+        int lookahead_mm = 0;
+        if (td.speed != 0) {
+            lookahead_mm = Calibration::stopping_distance(td.id, td.speed) +
+                           LOOKAHEAD_MARGIN_MM;
+            auto next_sensor_opt = track.next_sensor(td.pos.sensor);
+            if (next_sensor_opt.has_value())
+                lookahead_mm += next_sensor_opt.value().second;
+        }
+
+        track.release_behind(td.id, td.pos, TRAIN_TAIL_MM);
+        if (!track.reserve_footprint(td.id, td.pos, TRAIN_TAIL_MM,
+                                     lookahead_mm)) {
+            log_warning(uart, "train %u is running into reserved track!",
+                        td.id);
+            if (td.speed != 0) set_train_speed(td.id, 0);
+        }
+        replan_routes();
+    }
+
+    /// Re-plans the route of every train that's on its way somewhere, which
+    /// needs doing whenever reservations change. Each planner only revisits
+    /// the nodes whose costs changed since its last route, so this stays cheap
+    /// however many trains are running. Warns about any train that has been
+    /// cut off from its destination.
+    void replan_routes() {
+        for (size_t i = 0; i < MAX_TRAINS; i++) {
+            if (trains[i].id == 0 || !route_goals[i].has_value()) continue;
+            route_goal_t& goal = route_goals[i].value();
+
+            const track_node* nodes[TrackOracle::MAX_ROUTE_LEN];
+            size_t distance = 0;
+            const bool reachable =
+                planners[i].route(track, trains[i].pos.sensor, goal.dest,
+                                  nodes, TrackOracle::MAX_ROUTE_LEN, distance,
+                                  trains[i].id, goal.reversal_penalty_mm) >= 0;
+            if (goal.reachable && !reachable) {
+                log_warning(uart, "train %u has been cut off from %c%u!",
+                            trains[i].id, goal.dest.group, goal.dest.idx);
+            }
+            goal.reachable = reachable;
+        }
+    }
+
+    /// Predicts the tick at which a train will reach `pos`, by extrapolating
+    /// from where it was last seen. Returns std::nullopt if the train can't
+    /// get there given the current state of the track.
+    std::optional<int> predict_arrival(const train_descriptor_t& td,
+                                       const Marklin::track_pos_t& pos,
+                                       int now) const {
+        int dt = now - td.pos_observed_at;
+        assert(dt >= 0);
+
+        // TODO if our velocity measurements are way off, this distance
+        // could be WAY off - we should cap this at 2 sensor distances from
+        // the last observed sensor.
+        Marklin::track_pos_t curr_pos = td.pos;
+        curr_pos.offset_mm += td.velocity * dt / TICKS_PER_SEC;
+        // FIXME: implement offset normalization
+        // (i.e: if offset is > next sensor)
+        // required to be robust against broken sensors!
+
+        auto distance_opt = distance_between(curr_pos, pos);
+        if (!distance_opt.has_value()) return std::nullopt;
+        const int distance_mm = distance_opt.value();
+        if (distance_mm <= 0) return now;
+        if (td.velocity <= 0) return INT_MAX;
+        return now + (TICKS_PER_SEC * distance_mm) / td.velocity;
+    }
+
+    /// Wakes up the i'th waiting task, and removes it from the waiters.
+    void finish_wakeup(size_t i, bool success) {
+        assert(i < num_wakeups);
+        Res res = {.tag = MsgTag::WakeAtPos,
+                   .wake_at_pos = {.success = success}};
+        Reply(wakeups[i].tid, (char*)&res, sizeof(res));
+        std::copy(&wakeups[i + 1], &wakeups[num_wakeups], &wakeups[i]);
+        num_wakeups--;
+    }
+
+    void warn_no_route(const train_descriptor_t& td,
+                       const Marklin::track_pos_t& pos) {
+        log_warning(uart,
+                    "wake_at_pos: no route from %c%u@%d to %c%u@%d for "
+                    "train %u",
+                    td.pos.sensor.group, td.pos.sensor.idx, td.pos.offset_mm,
+                    pos.sensor.group, pos.sensor.idx, pos.offset_mm, td.id);
+    }
+
+    /// Re-predicts every waiting task's arrival time, which needs doing
+    /// whenever a train's position, velocity, or route changes. Tasks waiting
+    /// on a position that their train can no longer reach are woken up with
+    /// a failure.
+    void reschedule_wakeups() {
+        const int now = Clock::Time(clock);
+        for (size_t i = 0; i < num_wakeups;) {
+            wakeup_t& wake = wakeups[i];
+            const train_descriptor_t* td = descriptor_for(wake.train);
+            assert(td != nullptr);
+            auto eta_opt = predict_arrival(*td, wake.pos, now);
+            if (!eta_opt.has_value()) {
+                warn_no_route(*td, wake.pos);
+                finish_wakeup(i, false);
+                continue;
+            }
+            wake.eta = eta_opt.value();
+            i++;
+        }
+        sort_wakeups();
+    }
+
+    void sort_wakeups() {
+        std::sort(&wakeups[0], &wakeups[num_wakeups],
+                  [](const wakeup_t& a, const wakeup_t& b) {
+                      return a.eta < b.eta;
+                  });
+    }
+
+    /// Has an idle courier report back to the oracle at the given tick.
+    /// Returns false if they're all busy.
+    bool arm_wakeup_timer(int deadline) {
+        auto courier = idle_couriers.pop_front();
+        if (!courier.has_value()) return false;
+        Res res = {.tag = MsgTag::WakeupTimer,
+                   .wakeup_timer = {.deadline = deadline}};
+        Reply(courier.value(), (char*)&res, sizeof(res));
+        return true;
+    }
+
+    /// Wakes up any tasks whose trains have arrived, and arms a courier for
+    /// each one that's due before the next tick, so that it's woken on time.
+    /// Only the front of the (sorted) waiters ever needs looking at.
     void check_scheduled_wakeups() {
-        if (blocked_task.has_value()) {
-            // TODO: multiple task support
-            wakeup_t& wake = blocked_task.value();
-
-            // look up associated train descriptor
-            const train_descriptor_t* td_opt = descriptor_for(wake.train);
-            assert(td_opt != nullptr);
-            const train_descriptor_t& td = *td_opt;
-
-            // use td.pos, td.pos_observed_at + Clock::Time, and td.velocity to
-            // extrapolate the train's current position
-
-            int dt = Clock::Time(clock) - td.pos_observed_at;
-            assert(dt >= 0);
-
-            // TODO if our velocity measurements are way off, this distance
-            // could be WAY off - we should cap this at 2 sensor distances from
-            // the last observed sensor.
-            int distance_travelled_mm = td.velocity * dt / TICKS_PER_SEC;
-
-            Marklin::track_pos_t new_pos = td.pos;
-            new_pos.offset_mm += distance_travelled_mm;
-            // FIXME: implement offset normalization
-            // (i.e: if offset is > next sensor)
-            // required to be robust against broken sensors!
-
-            auto distance_to_target_opt = distance_between(new_pos, wake.pos);
-            if (!distance_to_target_opt.has_value()) {
-                // wake up the task, and remove it from the blocked list
-                log_line(uart,
-                         VT_YELLOW "WARNING" VT_NOFMT
-                                   " wake_at_pos: no route from %c%u@%d to "
-                                   "%c%u@%d for train %u",
-                         new_pos.sensor.group, new_pos.sensor.idx,
-                         new_pos.offset_mm, wake.pos.sensor.group,
-                         wake.pos.sensor.idx, wake.pos.offset_mm, td.id);
-                Res res = {.tag = MsgTag::WakeAtPos,
-                           .wake_at_pos = {.success = false}};
-                Reply(wake.tid, (char*)&res, sizeof(res));
-                blocked_task = std::nullopt;
-                return;
+        const int now = Clock::Time(clock);
+        bool needs_sort = false;
+        for (size_t i = 0;
+             i < num_wakeups && wakeups[i].eta - now <= max_tick_delay;) {
+            wakeup_t& wake = wakeups[i];
+            // once a courier's deadline passes, it's no longer out on this
+            // task's behalf
+            if (wake.timer_at <= now) wake.timer_at = -1;
+
+            // the prediction may be a few ticks old, so check it again
+            const train_descriptor_t* td = descriptor_for(wake.train);
+            assert(td != nullptr);
+            auto eta_opt = predict_arrival(*td, wake.pos, now);
+            if (!eta_opt.has_value()) {
+                warn_no_route(*td, wake.pos);
+                finish_wakeup(i, false);
+                continue;
+            }
+            const int eta = eta_opt.value();
+            if (eta <= now) {
+                log_line(uart, "train %d velocity=%dmm/s reached %c%u@%d",
+                         td->id, td->velocity, wake.pos.sensor.group,
+                         wake.pos.sensor.idx, wake.pos.offset_mm);
+                finish_wakeup(i, true);
+                continue;
             }
 
-            int distance_to_target_mm = distance_to_target_opt.value();
-            int ticks_until_target =
-                (TICKS_PER_SEC * distance_to_target_mm) / td.velocity;
-
-            log_line(
-                uart,
-                "train %d velocity=%dmm/s distance to target=%dmm "
-                "(%c%u@%d->%c%u@%d) ticks_until_target=%d",
-                td.id, td.velocity, distance_to_target_mm, new_pos.sensor.group,
-                new_pos.sensor.idx, new_pos.offset_mm, wake.pos.sensor.group,
-                wake.pos.sensor.idx, wake.pos.offset_mm, ticks_until_target);
-
-            // If we won't tick again until after the deadline, delay until the
-            // exact moment that we wish to respond.
-            if (ticks_until_target <= max_tick_delay) {
-                if (ticks_until_target > 0)
-                    Clock::Delay(clock, ticks_until_target);
-
-                // wake up the task, and remove it from the blocked list
-                Res res = {.tag = MsgTag::WakeAtPos,
-                           .wake_at_pos = {.success = true}};
-                Reply(wake.tid, (char*)&res, sizeof(res));
-                blocked_task = std::nullopt;
+            wake.eta = eta;
+            if (eta - now > max_tick_delay) {
+                needs_sort = true;
+            } else if (wake.timer_at == -1 || eta < wake.timer_at) {
+                // If we won't tick again until after the deadline, have a
+                // courier bring us back at the exact moment that we wish to
+                // respond.
+                if (arm_wakeup_timer(eta)) wake.timer_at = eta;
             }
+            i++;
         }
+        if (needs_sort) sort_wakeups();
     }
 
     void interpolate_acceleration(int now) {
@@ -274,11 +486,15 @@ class TrackOracleImpl {
     TrackOracleImpl& operator=(const TrackOracleImpl&) = delete;
     TrackOracleImpl& operator=(TrackOracleImpl&&) = delete;
 
-    TrackOracleImpl(int uart_tid, int clock_tid, Marklin::Track track_id)
+    TrackOracleImpl(int uart_tid,
+                    int marklin_uart_tid,
+                    int clock_tid,
+                    Marklin::Track track_id)
         : track(track_id),
           uart{uart_tid},
           clock{clock_tid},
-          marklin(uart_tid),
+          marklin(marklin_uart_tid),
+          num_wakeups{0},
           last_ticked_at{-1},
           max_tick_delay{0} {
         memset(trains, 0, sizeof(train_descriptor_t) * MAX_TRAINS);
@@ -308,29 +524,27 @@ class TrackOracleImpl {
     void make_loop() {
         // TODO: make the loops vary between the two tracks
 
-        // set all the branches to curved
-        for (size_t i = 0; auto& b : this->branches) {
-            const uint8_t id = Marklin::VALID_SWITCHES[i++];
-
-            b.set_id(id);
-            b.set_dir(Marklin::BranchDir::Curved);
+        // set all the branches to curved...
+        Marklin::BranchMask branches;
 
-            // ...but make outer-ring branches straight
-            for (size_t except_id : {6, 7, 8, 9, 14, 15}) {
-                if (id == except_id) {
-                    b.set_dir(Marklin::BranchDir::Straight);
-                    break;
-                }
-            }
+        // ...but make outer-ring branches straight
+        for (int id : {6, 7, 8, 9, 14, 15}) {
+            branches.set((uint8_t)id, Marklin::BranchDir::Straight);
         }
+        track.set_branches(branches);
 
         log_line(uart, "Setting switch positions...");
-        marklin.update_branches(this->branches,
-                                sizeof(Marklin::VALID_SWITCHES));
+        marklin.update_branches(branches);
         marklin.flush();
     }
 
-    void calibrate_train(uint8_t id) {
+    /// Starts calibrating a train. `tid` is replied to once the train hits a
+    /// sensor.
+    void calibrate_train(int tid, uint8_t id) {
+        if (calibrating.has_value()) {
+            panic("only one train can be calibrated at a time");
+        }
+
         train_descriptor_t* train = nullptr;
         for (train_descriptor_t& t : trains) {
             if (t.id == 0) {
@@ -343,34 +557,39 @@ class TrackOracleImpl {
 
         log_line(uart, "Stopping train %hhu...", id);
         set_train_speed(id, 0);
-        Clock::Delay(clock, 200);  // make sure it's slowed down
-
-        log_line(uart, "Waiting for train to hit a sensor...");
 
-        // give it some gas
-        set_train_speed(id, 8);
+        // make sure it's slowed down before going any further (if the
+        // couriers are all busy, the first tick after start_at will do)
+        const int start_at = Clock::Time(clock) + 200;
+        calibrating = {
+            .tid = tid, .train = train, .id = id, .start_at = start_at};
+        arm_wakeup_timer(start_at);
+    }
 
-        // loop until a sensor is hit
-        Marklin::SensorData sensor_data;
-        marklin.query_sensors(sensor_data.raw);  // clear residual sensor data
-        Marklin::sensor_t sensor;
+    /// Gives the train being calibrated some gas once it's had time to stop.
+    void check_calibration_start() {
+        if (!calibrating.has_value()) return;
+        calibration_t& cal = calibrating.value();
+        if (cal.start_at == -1 || Clock::Time(clock) < cal.start_at) return;
+        cal.start_at = -1;
 
-        while (true) {
-            marklin.query_sensors(sensor_data.raw);
+        log_line(uart, "Waiting for train to hit a sensor...");
 
-            auto sensor_opt = sensor_data.next_sensor();
-            if (sensor_opt.has_value()) {
-                sensor = sensor_opt.value();
+        // give it some gas, and wait for it to hit a sensor
+        set_train_speed(cal.id, 8);
+    }
 
-                log_line(uart, "Train hit sensor %c%hhu!", sensor.group,
-                         sensor.idx);
-                break;
-            }
-        }
+    /// Finishes calibrating a train, given the first sensor it hit.
+    void finish_calibration(Marklin::sensor_t sensor, int now) {
+        assert(calibrating.has_value());
+        const calibration_t cal = calibrating.value();
+        calibrating = std::nullopt;
 
-        set_train_speed(id, 0);  // stop the train
-        int now = Clock::Time(clock);
+        log_line(uart, "Train hit sensor %c%hhu!", sensor.group, sensor.idx);
+        set_train_speed(cal.id, 0);  // stop the train
 
+        const uint8_t id = cal.id;
+        train_descriptor_t* train = cal.train;
         *train = {
             .id = id,
             .speed = 0,
@@ -396,7 +615,11 @@ class TrackOracleImpl {
         };
 
         log_line(uart, "Done calibrating train %hhu...", id);
+        update_footprint(*train);
         Ui::render_train_descriptor(uart, *train);
+
+        Res res = {.tag = MsgTag::CalibrateTrain, .calibrate_train = {}};
+        Reply(cal.tid, (char*)&res, sizeof(res));
     }
 
     bool set_train_speed(uint8_t id, uint8_t speed) {
@@ -405,6 +628,7 @@ class TrackOracleImpl {
         train.set_speed(speed);
         train.set_light(true);
         marklin.update_train(train);
+        marklin.commit();
 
         // update train state (if the train is registered)
         train_descriptor_t* td_opt = descriptor_for(id);
@@ -425,6 +649,8 @@ class TrackOracleImpl {
             td.accelerating = true;
             td.speed_changed_at = now;
         }
+        update_footprint(td);
+        reschedule_wakeups();
         Ui::render_train_descriptor(uart, td);
 
         return true;
@@ -436,6 +662,7 @@ class TrackOracleImpl {
         train.set_speed(15);
         train.set_light(true);
         marklin.update_train(train);
+        marklin.commit();
 
         // update the train state (if the train is registered)
         train_descriptor_t* td_opt = descriptor_for(id);
@@ -452,8 +679,7 @@ class TrackOracleImpl {
         td.pos.sensor = track.invert_sensor(old_pos.sensor);
         td.pos.offset_mm = -old_pos.offset_mm;
 
-        auto next_sensor_opt =
-            track.next_sensor(td.pos.sensor, branches, BRANCHES_LEN);
+        auto next_sensor_opt = track.next_sensor(td.pos.sensor);
         if (next_sensor_opt.has_value()) {
             auto [sensor, distance] = next_sensor_opt.value();
             td.has_next_sensor = true;
@@ -463,51 +689,68 @@ class TrackOracleImpl {
             td.has_next_sensor = false;
         }
 
+        update_footprint(td);
+        reschedule_wakeups();
         Ui::render_train_descriptor(uart, td);
 
         return true;
     }
 
-    void set_branch_dir(uint8_t id, Marklin::BranchDir dir) {
-        for (auto& b : this->branches) {
-            if (b.get_id() == id) {
-                b.set_dir(dir);
-                marklin.update_branch(id, dir);
-
-                // re-calculate next sensor for all the trains
-                int now = Clock::Time(clock);
-                for (train_descriptor_t& td : trains) {
-                    if (td.id == 0) continue;
-
-                    auto next_sensor_opt = track.next_sensor(
-                        td.pos.sensor, branches, BRANCHES_LEN);
-                    if (next_sensor_opt.has_value()) {
-                        auto [sensor, distance] = next_sensor_opt.value();
-                        td.has_next_sensor = true;
-                        td.next_sensor = sensor;
-                        td.next_sensor_time =
-                            now + ((TICKS_PER_SEC * distance) / td.velocity);
-                    } else {
-                        td.has_next_sensor = false;
-                    }
-                }
+    /// Throws a switch on behalf of `train` (or nobody, if it's 0). Fails if
+    /// the switch is reserved by some other train.
+    bool set_branch_dir(uint8_t id, Marklin::BranchDir dir, uint8_t train) {
+        const uint8_t owner = track.switch_reserved_by(id);
+        if (owner != 0 && owner != train) {
+            log_warning(uart, "switch %u is reserved by train %u", id, owner);
+            return false;
+        }
+        if (!track.set_branch_dir(id, dir)) {
+            panic("called set_branch_dir with invalid branch id");
+        }
+        marklin.update_branch(id, dir);
+        marklin.commit();
 
-                return;
+        // re-calculate next sensor for all the trains
+        int now = Clock::Time(clock);
+        for (train_descriptor_t& td : trains) {
+            if (td.id == 0) continue;
+
+            auto next_sensor_opt = track.next_sensor(td.pos.sensor);
+            if (next_sensor_opt.has_value()) {
+                auto [sensor, distance] = next_sensor_opt.value();
+                td.has_next_sensor = true;
+                td.next_sensor = sensor;
+                td.next_sensor_time =
+                    now + ((TICKS_PER_SEC * distance) / td.velocity);
+            } else {
+                td.has_next_sensor = false;
             }
         }
-
-        panic("called set_branch_dir with invalid branch id");
+        // the trains may now be headed somewhere else entirely
+        reschedule_wakeups();
+        return true;
     }
 
-    void update_sensors() {
-        Marklin::SensorData sensor_data;
-        marklin.query_sensors(sensor_data.raw);
-
-        int now = Clock::Time(clock);
-        while (auto sensor_opt = sensor_data.next_sensor()) {
-            Marklin::sensor_t sensor = sensor_opt.value();
+    void update_sensors(const SensorPoller::event_t* events, size_t n) {
+        const int time = Clock::Time(clock);
+        const uint64_t time_us = Clock::TimeUs();
+
+        for (size_t i = 0; i < n; i++) {
+            const Marklin::sensor_t sensor = events[i].sensor;
+            // backdate the observation to when the sensor dump arrived
+            const int now =
+                time - (int)((time_us - events[i].first_byte_us) /
+                             (1000000 / TICKS_PER_SEC));
+
+            if (calibrating.has_value()) {
+                // anything triggered while the train is still stopping is
+                // ignored
+                if (calibrating.value().start_at == -1)
+                    finish_calibration(sensor, now);
+                continue;
+            }
 
-            train_descriptor_t* td_opt = attribute_sensor(sensor);
+            train_descriptor_t* td_opt = attribute_sensor(sensor, now);
             if (td_opt == nullptr) {
                 log_line(uart,
                          "could not attribute sensor %c%hhu to any train, "
@@ -594,8 +837,7 @@ class TrackOracleImpl {
                 td.has_error = false;
             }
 
-            auto next_sensor_opt =
-                track.next_sensor(sensor, branches, BRANCHES_LEN);
+            auto next_sensor_opt = track.next_sensor(sensor);
             if (next_sensor_opt.has_value()) {
                 auto [sensor, distance] = next_sensor_opt.value();
                 td.has_next_sensor = true;
@@ -606,6 +848,7 @@ class TrackOracleImpl {
                 td.has_next_sensor = false;
             }
 
+            update_footprint(td);
             Ui::render_train_descriptor(uart, td);
             log_line(uart,
                      "observed train %d from %c%02hhu->%c%02hhu dx=%dmm "
@@ -615,36 +858,102 @@ class TrackOracleImpl {
                      dt_ticks / TICKS_PER_SEC, dt_ticks % TICKS_PER_SEC,
                      new_velocity_mmps);
         }
+        reschedule_wakeups();
         tick();
     }
 
     void wake_at_pos(int tid, uint8_t train, Marklin::track_pos_t pos) {
-        if (blocked_task.has_value()) {
-            panic("only one task can block on a train (at the moment)");
+        Res res = {.tag = MsgTag::WakeAtPos,
+                   .wake_at_pos = {.success = false}};
+        if (num_wakeups == MAX_WAKEUPS) {
+            log_warning(uart, "wake_at_pos: too many waiting tasks");
+            Reply(tid, (char*)&res, sizeof(res));
+            return;
         }
 
-        if (descriptor_for(train) == nullptr) {
+        const train_descriptor_t* td = descriptor_for(train);
+        if (td == nullptr) {
             log_line(uart,
                      VT_YELLOW "WARNING" VT_NOFMT
                                " wake_at_pos: uncalibrated train %u",
                      train);
-            Res res = {.tag = MsgTag::WakeAtPos,
-                       .wake_at_pos = {.success = false}};
             Reply(tid, (char*)&res, sizeof(res));
             return;
         }
 
-        auto npos = track.normalize(pos, branches, BRANCHES_LEN);
+        auto npos = track.normalize(pos);
         log_line(uart, "normalized %c%u@%d to %c%u@%d", pos.sensor.group,
                  pos.sensor.idx, pos.offset_mm, npos.sensor.group,
                  npos.sensor.idx, npos.offset_mm);
-        blocked_task = {.tid = tid, .train = train, .pos = npos};
+
+        auto eta_opt = predict_arrival(*td, npos, Clock::Time(clock));
+        if (!eta_opt.has_value()) {
+            warn_no_route(*td, npos);
+            Reply(tid, (char*)&res, sizeof(res));
+            return;
+        }
+
+        // insert it in order, after any waiters due at the same time
+        const int eta = eta_opt.value();
+        size_t i = num_wakeups;
+        while (i > 0 && wakeups[i - 1].eta > eta) {
+            wakeups[i] = wakeups[i - 1];
+            i--;
+        }
+        wakeups[i] = {.tid = tid,
+                      .train = train,
+                      .pos = npos,
+                      .eta = eta,
+                      .timer_at = -1};
+        num_wakeups++;
     }
 
     train_descriptor_t* query_train(uint8_t train) {
         return descriptor_for(train);
     }
 
+    /// Finds a route for a train from its current position to `dest` which
+    /// avoids track held by other trains, and reserves it. Returns the number
+    /// of nodes in the route, or -1 if there isn't one.
+    int reserve_route(uint8_t id,
+                      const Marklin::sensor_t& dest,
+                      bool allow_reversals,
+                      uint8_t path[TrackOracle::MAX_ROUTE_LEN],
+                      size_t& distance) {
+        const train_descriptor_t* td = descriptor_for(id);
+        if (td == nullptr) return -1;
+
+        // Re-routing a train to the same destination only has to repair the
+        // parts of its last route that have been reserved or released since.
+        const size_t i = (size_t)(td - trains);
+        const int reversal_penalty_mm =
+            allow_reversals ? DEFAULT_REVERSAL_PENALTY_MM : NO_REVERSALS;
+        const track_node* nodes[TrackOracle::MAX_ROUTE_LEN];
+        int len = planners[i].route(track, td->pos.sensor, dest, nodes,
+                                    TrackOracle::MAX_ROUTE_LEN, distance, id,
+                                    reversal_penalty_mm);
+        if (len < 0) return -1;
+        if (!track.reserve_path(id, nodes, (size_t)len))
+            panic("reserve_route: route overlaps another train's track");
+        route_goals[i] = {.dest = dest,
+                          .reversal_penalty_mm = reversal_penalty_mm,
+                          .reachable = true};
+        replan_routes();
+
+        for (size_t i = 0; i < (size_t)len; i++)
+            path[i] = track.index_of(nodes[i]);
+        return len;
+    }
+
+    /// Releases a train's reservations, apart from the track it's sitting on.
+    void release_reservations(uint8_t id) {
+        train_descriptor_t* td = descriptor_for(id);
+        if (td == nullptr) return;
+        route_goals[td - trains] = std::nullopt;
+        track.release_all(id);
+        update_footprint(*td);
+    }
+
     void tick() {
         int now = Clock::Time(clock);
         if (last_ticked_at == -1) {
@@ -658,12 +967,29 @@ class TrackOracleImpl {
             last_ticked_at = now;
         }
 
+        // Accelerating trains' velocities change every tick, which throws off
+        // the predicted arrival times of anyone waiting on them.
+        bool any_accelerating = false;
+        for (const train_descriptor_t& td : trains)
+            any_accelerating |= td.id != 0 && td.accelerating;
+
         interpolate_acceleration(now);
+        if (any_accelerating) reschedule_wakeups();
         check_scheduled_wakeups();
+        check_calibration_start();
     }
 
     Marklin::track_pos_t normalize(const Marklin::track_pos_t& pos) {
-        return track.normalize(pos, branches, BRANCHES_LEN);
+        return track.normalize(pos);
+    }
+
+    /// Called when a wakeup courier reports back, either because it's just
+    /// started up, or because its deadline has passed.
+    void wakeup_timer_fired(int courier) {
+        if (idle_couriers.push_back(courier) == QueueErr::FULL)
+            panic("TrackOracle: too many wakeup couriers");
+        check_scheduled_wakeups();
+        check_calibration_start();
     }
 };
 
@@ -675,7 +1001,25 @@ void TrackOracleTickerTask() {
     const Req req = {.tag = MsgTag::Tick, .tick = {}};
     while (true) {
         Send(tid, (char*)&req, sizeof(req), nullptr, 0);
-        Clock::Delay(clock, 1);
+        Clock::Periodic(clock, 1);
+    }
+}
+
+/// Blocks on the oracle until it's armed with a deadline (as an absolute tick),
+/// waits until then, and then reports back. This keeps the oracle from ever
+/// waiting on the clock server itself.
+void TrackOracleWakeupCourier() {
+    int tid = MyParentTid();
+    assert(tid >= 0);
+    int clock = WhoIs(Clock::SERVER_ID);
+    assert(clock >= 0);
+    const Req req = {.tag = MsgTag::WakeupTimer, .wakeup_timer = {}};
+    Res res;
+    while (true) {
+        int n = Send(tid, (char*)&req, sizeof(req), (char*)&res, sizeof(res));
+        if (n != sizeof(res)) panic("truncated response");
+        if (res.tag != req.tag) panic("mismatched response kind");
+        Clock::DelayUntil(clock, res.wakeup_timer.deadline);
     }
 }
 
@@ -684,10 +1028,12 @@ void TrackOracleTask() {
     assert(nsres >= 0);
 
     int clock = WhoIs(Clock::SERVER_ID);
-    int uart = WhoIs(Uart::SERVER_ID);
+    int uart = WhoIs(Uart::COM2_SERVER_ID);
+    int marklin_uart = WhoIs(Uart::COM1_SERVER_ID);
 
     assert(clock >= 0);
     assert(uart >= 0);
+    assert(marklin_uart >= 0);
 
     log_line(uart, "Spawned TrackOracleTask!");
 
@@ -706,13 +1052,16 @@ void TrackOracleTask() {
     }
 
     // init the track oracle
-    TrackOracleImpl oracle = TrackOracleImpl(uart, clock, req.init.track);
+    TrackOracleImpl oracle =
+        TrackOracleImpl(uart, marklin_uart, clock, req.init.track);
 
     // respond once the oracle has been instantiated
     res.tag = req.tag;
     Reply(tid, (char*)&res, sizeof(res));
 
     Create(0, TrackOracleTickerTask);
+    for (size_t i = 0; i < NUM_WAKEUP_COURIERS; i++)
+        Create(1000, TrackOracleWakeupCourier);
 
     while (true) {
         int reqlen = Receive(&tid, (char*)&req, sizeof(req));
@@ -723,7 +1072,8 @@ void TrackOracleTask() {
 
         switch (req.tag) {
             case MsgTag::CalibrateTrain: {
-                oracle.calibrate_train(req.calibrate_train.id);
+                oracle.calibrate_train(tid, req.calibrate_train.id);
+                continue;  // replied to once the train hits a sensor
             } break;
             case MsgTag::WakeAtPos: {
                 oracle.wake_at_pos(tid, req.wake_at_pos.id,
@@ -742,8 +1092,9 @@ void TrackOracleTask() {
                     oracle.reverse_train(req.reverse_train.id);
             } break;
             case MsgTag::SetBranchDir: {
-                oracle.set_branch_dir(req.set_branch_dir.id,
-                                      req.set_branch_dir.dir);
+                res.set_branch_dir.success = oracle.set_branch_dir(
+                    req.set_branch_dir.id, req.set_branch_dir.dir,
+                    req.set_branch_dir.train);
             } break;
             case MsgTag::QueryTrain: {
                 train_descriptor_t* td = oracle.query_train(req.query_train.id);
@@ -757,8 +1108,18 @@ void TrackOracleTask() {
             case MsgTag::QueryBranch: {
                 panic("TrackOracle: QueryBranch message unimplemented");
             } break;
+            case MsgTag::ReserveRoute: {
+                res.reserve_route.len = oracle.reserve_route(
+                    req.reserve_route.id, req.reserve_route.dest,
+                    req.reserve_route.allow_reversals, res.reserve_route.path,
+                    res.reserve_route.distance);
+            } break;
+            case MsgTag::ReleaseReservations: {
+                oracle.release_reservations(req.release_reservations.id);
+            } break;
             case MsgTag::UpdateSensors: {
-                oracle.update_sensors();
+                oracle.update_sensors(req.update_sensors.events,
+                                      req.update_sensors.n);
             } break;
             case MsgTag::Tick: {
                 oracle.tick();
@@ -769,6 +1130,10 @@ void TrackOracleTask() {
             case MsgTag::MakeLoop: {
                 oracle.make_loop();
             } break;
+            case MsgTag::WakeupTimer: {
+                oracle.wakeup_timer_fired(tid);
+                continue;  // replied to once there's another deadline
+            } break;
             default:
                 panic("TrackOracle: unexpected request tag: %d", (int)req.tag);
         }
@@ -846,17 +1211,60 @@ bool TrackOracle::reverse_train(uint8_t id) {
 }
 
 /// Update a branch's direction
-void TrackOracle::set_branch_dir(uint8_t id, Marklin::BranchDir dir) {
+bool TrackOracle::set_branch_dir(uint8_t id,
+                                 Marklin::BranchDir dir,
+                                 uint8_t train_id) {
     Req req = {.tag = MsgTag::SetBranchDir,
-               .set_branch_dir = {.id = id, .dir = dir}};
-    send_with_assert_empty_response(this->tid, req);
+               .set_branch_dir = {.id = id, .dir = dir, .train = train_id}};
+    Res res;
+    int n = Send(tid, (char*)&req, sizeof(req), (char*)&res, sizeof(res));
+    if (n != sizeof(res)) panic("truncated response");
+    if (res.tag != req.tag) panic("mismatched response kind");
+    return res.set_branch_dir.success;
+}
+
+int TrackOracle::reserve_route(uint8_t train_id,
+                               const Marklin::sensor_t& dest,
+                               uint8_t path[MAX_ROUTE_LEN],
+                               size_t& distance,
+                               bool allow_reversals) {
+    Req req = {.tag = MsgTag::ReserveRoute,
+               .reserve_route = {.id = train_id,
+                                 .dest = dest,
+                                 .allow_reversals = allow_reversals}};
+    Res res;
+    int n = Send(tid, (char*)&req, sizeof(req), (char*)&res, sizeof(res));
+    if (n != sizeof(res)) panic("truncated response");
+    if (res.tag != req.tag) panic("mismatched response kind");
+    if (res.reserve_route.len < 0) return -1;
+    memcpy(path, res.reserve_route.path, (size_t)res.reserve_route.len);
+    distance = res.reserve_route.distance;
+    return res.reserve_route.len;
 }
 
-void TrackOracle::update_sensors() {
-    Req req = {.tag = MsgTag::UpdateSensors, .update_sensors = {}};
+void TrackOracle::release_reservations(uint8_t train_id) {
+    Req req = {.tag = MsgTag::ReleaseReservations,
+               .release_reservations = {.id = train_id}};
     send_with_assert_empty_response(this->tid, req);
 }
 
+void TrackOracle::update_sensors(const SensorPoller::event_t* events,
+                                 size_t n) {
+    assert(n <= SensorPoller::MAX_EVENTS);
+    Req req;
+    req.tag = MsgTag::UpdateSensors;
+    req.update_sensors.n = n;
+    memcpy(req.update_sensors.events, events, n * sizeof(*events));
+
+    // only send the events that are actually in use
+    const size_t len = offsetof(Req, update_sensors.events) +
+                       n * sizeof(SensorPoller::event_t);
+    Res res;
+    int ret = Send(tid, (char*)&req, (int)len, (char*)&res, sizeof(res));
+    if (ret != sizeof(res)) panic("truncated response");
+    if (res.tag != req.tag) panic("mismatched response kind");
+}
+
 void TrackOracle::make_loop() {
     Req req = {.tag = MsgTag::MakeLoop, .make_loop = {}};
     send_with_assert_empty_response(this->tid, req);
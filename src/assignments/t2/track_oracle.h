@@ -4,7 +4,9 @@
 #include <cstdint>
 #include <optional>
 
+#include "common/track_node.h"
 #include "marklin.h"
+#include "sensor_poller.h"
 
 #define TICKS_PER_SEC 100
 
@@ -51,6 +53,9 @@ class TrackOracle {
     int tid;
 
    public:
+    /// A route never visits a node more than once.
+    static constexpr size_t MAX_ROUTE_LEN = TRACK_MAX;
+
     /// Create a new track oracle task for the given track, resetting the
     /// track's branches to a preset state.
     TrackOracle(Marklin::Track track);
@@ -73,12 +78,32 @@ class TrackOracle {
     /// registered, or if the train has a non-zero speed (NOT VELOCITY!).
     bool reverse_train(uint8_t train_id);
 
-    /// Update a branch's direction
-    void set_branch_dir(uint8_t branch_id, Marklin::BranchDir dir);
-
-    /// query the marklin for sensor data, updating the internal model
-    /// appropriately
-    void update_sensors();
+    /// Update a branch's direction, on behalf of the given train (or nobody,
+    /// if train_id is 0). Returns false if the branch is reserved by some
+    /// other train.
+    [[nodiscard]] bool set_branch_dir(uint8_t branch_id,
+                                      Marklin::BranchDir dir,
+                                      uint8_t train_id = 0);
+
+    /// Find a route for the train from its current position to `dest` which
+    /// avoids any track reserved by other trains, and reserve it (trains
+    /// always hold the track under them, and enough track ahead of them to
+    /// stop in). `path` is filled with the route's nodes, as indices into the
+    /// track's node table. Returns the number of nodes in the route, or -1 if
+    /// there's no conflict-free route.
+    ///
+    /// If `allow_reversals` is false, only routes along which the train never
+    /// reverses are considered.
+    int reserve_route(uint8_t train_id,
+                      const Marklin::sensor_t& dest,
+                      uint8_t path[MAX_ROUTE_LEN],
+                      size_t& distance,
+                      bool allow_reversals = true);
+    /// Release the train's reservations, apart from the track it's on.
+    void release_reservations(uint8_t train_id);
+
+    /// update the internal model with newly triggered sensors
+    void update_sensors(const SensorPoller::event_t* events, size_t n);
 
     /// reset the track's switches to have a loop
     void make_loop();
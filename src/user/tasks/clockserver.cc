@@ -1,6 +1,7 @@
 #include <climits>
 #include <cstdint>
 #include <cstring>
+#include <optional>
 
 #include "common/priority_queue.h"
 #include "common/ts7200.h"
@@ -10,17 +11,46 @@
 
 #define USER_TICKS_PER_SEC 100    // 10ms
 #define TIMER_TICKS_PER_SEC 2000  // 2 kHz
+#define TIMER3_TICKS_PER_SEC 508469  // 508 kHz
+#define MAX_PERIODIC_TASKS 8
+
+static const volatile uint32_t* TIMER3_VAL =
+    (volatile uint32_t*)(TIMER3_BASE + VAL_OFFSET);
 
 namespace Clock {
 const char* SERVER_ID = "ClockServer";
+
+// Number of times the top bit of TIMER3's elapsed count has flipped, as
+// observed by the clock server. TIMER3 is only 32 bits wide, so this acts as
+// the upper bits of a 64 bit tick counter. Only the clock server writes to it,
+// and since it's a single word, TimeUs() can read it without any locking.
+static volatile uint32_t timer3_half_periods = 0;
+
+static inline uint32_t timer3_elapsed() { return UINT32_MAX - *TIMER3_VAL; }
+
+// Called by the clock server on every tick. Half a TIMER3 period is ~70
+// minutes, so the server never misses more than one flip.
+static inline void update_timer3_half_periods() {
+    uint32_t top_bit = timer3_elapsed() >> 31;
+    if (top_bit != (timer3_half_periods & 1))
+        timer3_half_periods = timer3_half_periods + 1;
+}
+
 struct DelayedTask {
     int tid;
     // make the task ready once *timer3_value_reg < tick_threshold
     int tick_threshold;
 };
 
+struct PeriodicTask {
+    int tid;
+    int period;
+    // tick at which the task will next be woken up
+    int next_boundary;
+};
+
 struct Request {
-    enum { Time, Delay, DelayUntil, NotifierTick, Shutdown } tag;
+    enum { Time, Delay, DelayUntil, Periodic, NotifierTick, Shutdown } tag;
     union {
         struct {
         } time;
@@ -28,6 +58,7 @@ struct Request {
         } notifier_tick;
         int delay;
         int delay_until;
+        int periodic;
         struct {
         } shutdown;
     };
@@ -68,8 +99,22 @@ static void enqueue_task(PriorityQueue<DelayedTask, 32>& pq, int tid, int tick_t
     assert(pq.peek()->tick_threshold <= tick_threshold);
 }
 
+// Returns the slot registered to `tid`, or the first free slot if `tid` isn't
+// registered yet. Returns nullptr if there are no free slots.
+static std::optional<PeriodicTask>* find_periodic(
+    std::optional<PeriodicTask> (&periodic)[MAX_PERIODIC_TASKS],
+    int tid) {
+    std::optional<PeriodicTask>* free_slot = nullptr;
+    for (auto& p : periodic) {
+        if (p.has_value() && p.value().tid == tid) return &p;
+        if (!p.has_value() && free_slot == nullptr) free_slot = &p;
+    }
+    return free_slot;
+}
+
 void Server() {
     PriorityQueue<DelayedTask, 32> pq;
+    std::optional<PeriodicTask> periodic[MAX_PERIODIC_TASKS];
 
     // initialize timer2 to fire interrupts every 10 ms
     *(volatile uint32_t*)(TIMER2_BASE + CRTL_OFFSET) = 0;
@@ -102,6 +147,7 @@ void Server() {
                 bool shutdown = false;
                 Reply(tid, (char*)&shutdown, sizeof(shutdown));
                 current_time++;
+                update_timer3_half_periods();
 
                 while (true) {
                     const DelayedTask* hd = pq.peek();
@@ -149,6 +195,46 @@ void Server() {
 
                 break;
             }
+            case Request::Periodic: {
+                debug("Clock::Server: Periodic(%d)", req.periodic);
+                std::optional<PeriodicTask>* slot =
+                    find_periodic(periodic, tid);
+                if (req.periodic <= 0) {
+                    if (slot != nullptr) *slot = std::nullopt;
+                    res = {.tag = Response::Empty, .empty = {}};
+                    Reply(tid, (char*)&res, sizeof(res));
+                    break;
+                }
+                if (slot == nullptr) panic("too many periodic tasks");
+
+                if (!slot->has_value() ||
+                    slot->value().period != req.periodic) {
+                    *slot = {.tid = tid,
+                             .period = req.periodic,
+                             .next_boundary = current_time + req.periodic};
+                } else {
+                    PeriodicTask& p = slot->value();
+                    p.next_boundary += p.period;
+                    if (p.next_boundary < current_time) {
+                        // the task overran one or more periods - skip the
+                        // boundaries it missed, but stay phase-locked. One
+                        // that lands on the current tick still counts.
+                        int missed = (current_time - p.next_boundary +
+                                      p.period - 1) /
+                                     p.period;
+                        p.next_boundary += missed * p.period;
+                    }
+                }
+                if (slot->value().next_boundary == current_time) {
+                    // already at the boundary, so there's nothing to wait for
+                    res = {.tag = Response::Empty, .empty = {}};
+                    Reply(tid, (char*)&res, sizeof(res));
+                    break;
+                }
+                enqueue_task(pq, tid, slot->value().next_boundary);
+
+                break;
+            }
             case Request::Shutdown: {
                 while (true) {
                     int tid_;
@@ -202,6 +288,26 @@ int DelayUntil(int clockserver, int ticks) {
     return 0;
 }
 
+uint64_t TimeUs() {
+    uint32_t half_periods = timer3_half_periods;
+    uint32_t elapsed = timer3_elapsed();
+    // If the top bit disagrees with the recorded parity, TIMER3 flipped
+    // since the clock server last ticked.
+    if ((elapsed >> 31) != (half_periods & 1)) half_periods++;
+    uint64_t ticks = ((uint64_t)(half_periods >> 1) << 32) | elapsed;
+    return ticks * 1000000 / TIMER3_TICKS_PER_SEC;
+}
+
+int Periodic(int clockserver, int period) {
+    Request req = {.tag = Request::Periodic, .periodic = period};
+    Response res;
+    int n =
+        Send(clockserver, (char*)&req, sizeof(req), (char*)&res, sizeof(res));
+    if (n != sizeof(res)) return -1;
+    if (res.tag != Response::Empty) return -1;
+    return 0;
+}
+
 void Shutdown(int clockserver) {
     Request req = {.tag = Request::Shutdown, .shutdown = {}};
     Send(clockserver, (char*)&req, sizeof(req), nullptr, 0);
@@ -1,5 +1,6 @@
 #include "user/tasks/uartserver.h"
 
+#include <algorithm>
 #include <climits>
 #include <cstdarg>
 #include <cstring>
@@ -12,11 +13,33 @@
 
 namespace Uart {
 const char* SERVER_ID = "UartServer";
+const char* COM1_SERVER_ID = "UartServerCOM1";
+const char* COM2_SERVER_ID = "UartServerCOM2";
 #define IOBUF_SIZE 4096
-#define MAX_GETN_SIZE 10
+#define MAX_TX_WRITERS 16
+#define MAX_TX_FRAMES 128
+#define MAX_FLUSH_WAITERS 16
+#define URGENT_TXBUF_SIZE 64
+
+// TX buffer sizes can be tuned per channel (e.g: -DCOM2_TXBUF_SIZE=16384)
+#ifndef COM1_TXBUF_SIZE
+#define COM1_TXBUF_SIZE 1024
+#endif
+#ifndef COM2_TXBUF_SIZE
+#define COM2_TXBUF_SIZE 8192
+#endif
+#define TXBUF_SIZE \
+    (COM1_TXBUF_SIZE > COM2_TXBUF_SIZE ? COM1_TXBUF_SIZE : COM2_TXBUF_SIZE)
+#define RXBUF_SIZE 512
+#define MAX_RX_READERS 8
 #define COM1_WAITING_FOR_DOWN_TIMEOUT 25  // 250ms
+#define COM1_WAITING_FOR_DOWN_TIMEOUT_US (COM1_WAITING_FOR_DOWN_TIMEOUT * 10000)
 
-using Iobuf = Queue<char, IOBUF_SIZE>;
+using Iobuf = Queue<char, TXBUF_SIZE>;
+using UrgentIobuf = Queue<char, URGENT_TXBUF_SIZE>;
+
+static constexpr size_t TX_CAPACITY[2] = {COM1_TXBUF_SIZE, COM2_TXBUF_SIZE};
+using Rxbuf = Queue<char, RXBUF_SIZE>;
 
 struct CTSState {
     enum {
@@ -26,7 +49,7 @@ struct CTSState {
     } tag;
     union {
         struct {
-            int since;
+            uint64_t since_us;
         } waiting_for_down;
         struct {
         } waiting_for_up;
@@ -35,17 +58,32 @@ struct CTSState {
     };
 };
 
+// Block: wait until the whole message fits in the TX buffer.
+// Try: accept as much of the message as currently fits, without blocking.
+enum class PutstrMode { Block, Try };
+
 struct Request {
-    enum { Notify, Putstr, Getn, Drain, Flush } tag;
+    enum { Notify, CTSTimeout, Putstr, Getn, TryGetn, Drain, Flush } tag;
     union {
         struct {
             int channel;
             int eventid;
             UARTIntIDIntClr data;
         } notify;
+        struct {
+        } cts_timeout;
         struct {
             int channel;
+            PutstrMode mode;
+            Lane lane;
+            // set when retrying a Block write that the server has already
+            // reserved space for.
+            bool reserved;
             size_t len;
+            // if non-zero, `buf` holds this many Normal lane frames back to
+            // back, of frame_lens[i] bytes each. Otherwise, it's one frame.
+            size_t num_frames;
+            uint8_t frame_lens[MAX_PUT_FRAMES];
             // must be the last element in this struct, may not be
             // completely copied.
             char buf[IOBUF_SIZE];
@@ -54,6 +92,10 @@ struct Request {
             int channel;
             size_t n;
         } getn;
+        struct {
+            int channel;
+            size_t n;
+        } try_getn;
         struct {
             int channel;
         } drain;
@@ -64,26 +106,84 @@ struct Request {
 };
 
 // Request.putstr.buf is very large, and it would be wasteful to copy the
-// whole buf every time we want to write a string. Instead, tasks that send
-// a Putstr request can truncate the request, only sending the tag, headers
-// and first `len` bytes of `buf`. This only works because `buf` is the last
-// member of Request.
-static inline size_t putstr_request_size(const Request& req) {
-    return offsetof(Request, putstr.buf) + req.putstr.len;
+// whole Request every time we send a message. Instead, senders truncate the
+// request to the tag plus the variant in use, and Putstr requests further
+// truncate `buf` to its first `len` bytes. This only works because `buf` is
+// the last member of Request.
+#define REQUEST_HEADER_SIZE offsetof(Request, notify)
+#define REQUEST_SIZE_OF(variant) \
+    (REQUEST_HEADER_SIZE + sizeof(((Request*)nullptr)->variant))
+
+static inline size_t request_size(const Request& req) {
+    switch (req.tag) {
+        case Request::Notify:
+            return REQUEST_SIZE_OF(notify);
+        case Request::CTSTimeout:
+            return REQUEST_SIZE_OF(cts_timeout);
+        case Request::Putstr:
+            return offsetof(Request, putstr.buf) + req.putstr.len;
+        case Request::Getn:
+            return REQUEST_SIZE_OF(getn);
+        case Request::TryGetn:
+            return REQUEST_SIZE_OF(try_getn);
+        case Request::Drain:
+            return REQUEST_SIZE_OF(drain);
+        case Request::Flush:
+            return REQUEST_SIZE_OF(flush);
+        default:
+            panic("Uart: bad request tag %d", (int)req.tag);
+    }
+}
+
+// Checks that a received message of `reqlen` bytes is exactly as large as its
+// tag says it should be.
+static inline bool request_is_valid(const Request& req, int reqlen) {
+    if (reqlen < (int)REQUEST_HEADER_SIZE) return false;
+    switch (req.tag) {
+        case Request::Notify:
+        case Request::CTSTimeout:
+        case Request::Getn:
+        case Request::TryGetn:
+        case Request::Drain:
+        case Request::Flush:
+            break;
+        case Request::Putstr:
+            // make sure `len` was actually sent before trusting it
+            if (reqlen < (int)offsetof(Request, putstr.buf)) return false;
+            if (req.putstr.len > IOBUF_SIZE) return false;
+            if (req.putstr.num_frames > 0) {
+                if (req.putstr.num_frames > MAX_PUT_FRAMES) return false;
+                if (req.putstr.lane != Lane::Normal) return false;
+                size_t total = 0;
+                for (size_t i = 0; i < req.putstr.num_frames; i++)
+                    total += req.putstr.frame_lens[i];
+                if (total != req.putstr.len) return false;
+            }
+            break;
+        default:
+            return false;
+    }
+    return reqlen == (int)request_size(req);
 }
 
+static inline int send_request(int tid,
+                               const Request& req,
+                               char* reply,
+                               int rplen) {
+    return Send(tid, (char*)&req, (int)request_size(req), reply, rplen);
+}
+
+// Getn and TryGetn are replied to with the raw bytes that were read.
 struct Response {
-    enum { Putstr, Getn } tag;
+    enum { Putstr } tag;
     union {
         struct {
             bool success;
+            // space has been reserved for a parked Block write, and it
+            // should be sent again.
+            bool retry;
             int bytes_written;
         } putstr;
-        struct {
-            bool success;
-            size_t n;
-            char bytes[MAX_GETN_SIZE];
-        } getn;
     };
 };
 
@@ -99,22 +199,35 @@ static void Notifier(int channel, int eventid) {
         debug("Notifier: AwaitEvent(%d)", eventid);
         req.notify.data.raw = (uint32_t)AwaitEvent(eventid);
 
-        // TODO sizeof(req) will be really big because of the Putstr buf we
-        // should have a generic sizeof function that switches on the tag.
         debug("Notifier: received channel=%d data=0x%lx", channel,
               req.notify.data.raw);
-        int n = Send(myparent, (char*)&req, sizeof(req), (char*)&shutdown,
-                     sizeof(shutdown));
+        int n = send_request(myparent, req, (char*)&shutdown,
+                             sizeof(shutdown));
         if (n != sizeof(shutdown))
             panic("Uart::Notifier - bad response length %d", n);
     }
 }
 
-static void set_up_uarts() {
-    // uart 2
-    bwsetfifo(COM2, true);
+// Blocks on the server until it arms a CTS timeout (by replying with a number
+// of ticks), waits that long, and then reports back. This keeps the COM1 CTS
+// state machine from ever waiting on the clock server itself.
+static void COM1CTSTimeoutCourier() {
+    int server = MyParentTid();
+    int clock = WhoIs(Clock::SERVER_ID);
+    assert(clock >= 0);
+    const Request req = {.tag = Request::CTSTimeout, .cts_timeout = {}};
+    while (true) {
+        int ticks;
+        int n = send_request(server, req, (char*)&ticks, sizeof(ticks));
+        if (n != sizeof(ticks))
+            panic("Uart::COM1CTSTimeoutCourier - bad response length %d", n);
+        Clock::Delay(clock, ticks);
+    }
+}
+
+static void set_up_com2() { bwsetfifo(COM2, true); }
 
-    // uart 1
+static void set_up_com1() {
     volatile int* mid = (volatile int*)(UART1_BASE + UART_LCRM_OFFSET);
     volatile int* low = (volatile int*)(UART1_BASE + UART_LCRL_OFFSET);
     volatile int* high = (volatile int*)(UART1_BASE + UART_LCRH_OFFSET);
@@ -186,33 +299,32 @@ static void enable_tx_interrupts(int channel) {
     }
 }
 
-static bool clear_to_send(int channel, CTSState& com1_cts, int clock) {
+// Transitions COM1 out of WAITING_FOR_DOWN if CTS hasn't been observed to drop
+// within COM1_WAITING_FOR_DOWN_TIMEOUT of the last byte being sent (i.e: we
+// missed the modem interrupt). Returns the number of ticks left until the
+// timeout if it hasn't expired yet.
+static int check_cts_timeout(CTSState& com1_cts) {
+    if (com1_cts.tag != CTSState::WAITING_FOR_DOWN) return 0;
+    uint64_t elapsed_us = Clock::TimeUs() - com1_cts.waiting_for_down.since_us;
+    if (elapsed_us >= COM1_WAITING_FOR_DOWN_TIMEOUT_US) {
+        com1_cts = {.tag = CTSState::ACTUALLY_CTS, .actually_cts = {}};
+        return 0;
+    }
+    uint64_t remaining_us = COM1_WAITING_FOR_DOWN_TIMEOUT_US - elapsed_us;
+    return (int)((remaining_us + 9999) / 10000);
+}
+
+static bool clear_to_send(int channel, CTSState& com1_cts) {
     uint32_t flags = *flags_for(channel);
     switch (channel) {
         case COM1: {
             bool tx = !(flags & TXFF_MASK);
             bool cts = (flags & CTS_MASK);
             if (!(tx && cts)) return false;
-            switch (com1_cts.tag) {
-                case CTSState::ACTUALLY_CTS:
-                    com1_cts = {
-                        .tag = CTSState::WAITING_FOR_DOWN,
-                        .waiting_for_down = {.since = Clock::Time(clock)}};
-                    return true;
-                case CTSState::WAITING_FOR_DOWN:
-                    if (Clock::Time(clock) >
-                        com1_cts.waiting_for_down.since +
-                            COM1_WAITING_FOR_DOWN_TIMEOUT) {
-                        com1_cts = {
-                            .tag = CTSState::WAITING_FOR_DOWN,
-                            .waiting_for_down = {.since = Clock::Time(clock)}};
-                        return true;
-                    }
-                    return false;
-                case CTSState::WAITING_FOR_UP:
-                    return false;
-            }
-            return false;
+            if (com1_cts.tag != CTSState::ACTUALLY_CTS) return false;
+            com1_cts = {.tag = CTSState::WAITING_FOR_DOWN,
+                        .waiting_for_down = {.since_us = Clock::TimeUs()}};
+            return true;
         }
         case COM2:
             return !(flags & TXFF_MASK);
@@ -233,58 +345,246 @@ static void enable_rx_interrupts(int channel) {
 
 struct rx_blocked_task_t {
     int tid;
-    size_t written;
-    Response getn_res;
+    size_t n;
+};
+
+using RxReaders = Queue<rx_blocked_task_t, MAX_RX_READERS>;
+
+// Moves any bytes sitting in the channel's hardware FIFO into its RX ring.
+static void drain_rx_fifo(int channel, Rxbuf& rx, size_t& dropped) {
+    const volatile uint32_t* flags = flags_for(channel);
+    volatile char* data = data_for(channel);
+    while (!(*flags & RXFE_MASK)) {
+        char c = *data;
+        if (rx.push_back(c) == QueueErr::FULL) dropped++;
+    }
+}
+
+// Replies to queued readers (in FIFO order) for as long as the RX ring holds
+// enough bytes to satisfy the reader at the front of the queue.
+static void serve_rx_readers(RxReaders& readers, Rxbuf& rx) {
+    while (const rx_blocked_task_t* reader = readers.peek_front()) {
+        if (rx.size() < reader->n) break;
+        char bytes[reader->n];
+        for (size_t i = 0; i < reader->n; i++) {
+            bytes[i] = rx.pop_front().value();
+        }
+        debug("replying to getn tid=%d n=%u", reader->tid, reader->n);
+        Reply(reader->tid, bytes, (int)reader->n);
+        readers.pop_front();
+    }
+}
+
+/// Bytes waiting to be sent on a channel, split into lanes by priority.
+///
+/// Every write (or each message of a PutFrames) is kept as a frame. Frames in
+/// the Urgent lane are sent before any frames queued in the Normal lane, but a
+/// frame is never interrupted once its first byte has been sent.
+class TxLanes {
+    Iobuf normal;
+    UrgentIobuf urgent;
+    Queue<size_t, MAX_TX_FRAMES> normal_frames;
+    Queue<size_t, URGENT_TXBUF_SIZE> urgent_frames;
+    // Set when a Normal frame didn't fit in normal_frames. Until the queued
+    // frames are sent, any further bytes are lumped into one trailing frame,
+    // which only coarsens the points at which Urgent frames can cut in.
+    bool normal_frames_overflowed;
+
+    Lane current_lane;
+    size_t current_remaining;
+
+   public:
+    // total number of bytes ever queued / sent in each lane, indexed by Lane
+    size_t queued[2];
+    size_t sent[2];
+
+    TxLanes()
+        : normal(),
+          urgent(),
+          normal_frames(),
+          urgent_frames(),
+          normal_frames_overflowed{false},
+          current_lane{Lane::Normal},
+          current_remaining{0},
+          queued{0, 0},
+          sent{0, 0} {}
+
+    bool is_empty() const { return normal.is_empty() && urgent.is_empty(); }
+    size_t normal_size() const { return normal.size(); }
+
+    /// Queues a frame. Returns false (queueing nothing) if it doesn't fit.
+    bool push_frame(Lane lane, const char* msg, size_t len) {
+        if (len == 0) return true;
+        if (lane == Lane::Urgent) {
+            if (urgent.available() < len || urgent_frames.available() == 0)
+                return false;
+            for (size_t i = 0; i < len; i++) urgent.push_back(msg[i]);
+            urgent_frames.push_back(len);
+        } else {
+            if (normal.available() < len) return false;
+            for (size_t i = 0; i < len; i++) normal.push_back(msg[i]);
+            if (!normal_frames_overflowed &&
+                normal_frames.push_back(len) == QueueErr::FULL)
+                normal_frames_overflowed = true;
+        }
+        queued[(size_t)lane] += len;
+        return true;
+    }
+
+    /// Returns the next byte to send.
+    /// precondition: !is_empty()
+    char pop() {
+        if (current_remaining == 0) {
+            if (!urgent.is_empty()) {
+                current_lane = Lane::Urgent;
+                current_remaining = urgent_frames.pop_front().value();
+            } else if (!normal_frames.is_empty()) {
+                current_lane = Lane::Normal;
+                current_remaining = normal_frames.pop_front().value();
+            } else {
+                // everything left over from an overflow is one big frame
+                current_lane = Lane::Normal;
+                current_remaining = normal.size();
+                normal_frames_overflowed = false;
+            }
+        }
+        current_remaining--;
+        sent[(size_t)current_lane]++;
+        if (current_lane == Lane::Urgent) return urgent.pop_front().value();
+        return normal.pop_front().value();
+    }
 };
 
+/// A task waiting for every byte queued before its Flush call to be sent.
 struct flush_blocked_task_t {
     int tid;
-    size_t bytes_remaining;
+    // the value of TxLanes::queued at the time of the Flush
+    size_t until[2];
 };
 
-inline static void record_byte_sent(std::optional<flush_blocked_task_t>& t) {
-    if (t.has_value()) {
-        flush_blocked_task_t& task = t.value();
-        task.bytes_remaining--;
-        if (task.bytes_remaining == 0) {
-            Reply(task.tid, nullptr, 0);
-            t = std::nullopt;
-        }
+// Since the per-lane `queued` counters only ever grow, each waiter's offsets
+// are >= those of every waiter that flushed before it, so waiters are always
+// released in FIFO order.
+using FlushWaiters = Queue<flush_blocked_task_t, MAX_FLUSH_WAITERS>;
+
+inline static bool flush_done(const flush_blocked_task_t& t,
+                              const TxLanes& tx) {
+    return tx.sent[0] >= t.until[0] && tx.sent[1] >= t.until[1];
+}
+
+inline static void release_flush_waiters(FlushWaiters& waiters,
+                                         const TxLanes& tx) {
+    while (const flush_blocked_task_t* t = waiters.peek_front()) {
+        if (!flush_done(*t, tx)) break;
+        Reply(t->tid, nullptr, 0);
+        waiters.pop_front();
+    }
+}
+
+// Writes as much of `tx` to the wire as the UART will currently accept,
+// enabling TX interrupts if anything is left over.
+static void write_tx(int channel,
+                     TxLanes& tx,
+                     CTSState& com1_cts,
+                     FlushWaiters& flush_waiters) {
+    volatile char* data = data_for(channel);
+    int bytes_written = 0;
+    while (!tx.is_empty() && clear_to_send(channel, com1_cts)) {
+        char c = tx.pop();
+        if (channel == COM1) enable_tx_interrupts(channel);
+        *data = c;
+        bytes_written++;
+    }
+    debug("Server: wrote %d bytes, %u left in normal lane", bytes_written,
+          tx.normal_size());
+    release_flush_waiters(flush_waiters, tx);
+
+    if (!tx.is_empty()) enable_tx_interrupts(channel);
+}
+
+// A Putstr in Block mode that didn't fit in the TX buffer. Only the length is
+// kept: once enough space frees up, it's reserved and the writer is told to
+// send its message again.
+struct tx_blocked_task_t {
+    int tid;
+    size_t len;
+};
+
+using TxWriters = Queue<tx_blocked_task_t, MAX_TX_WRITERS>;
+
+static void wake_tx_writers(TxWriters& writers,
+                            const TxLanes& tx,
+                            size_t capacity,
+                            size_t& reserved) {
+    while (const tx_blocked_task_t* writer = writers.peek_front()) {
+        if (capacity - tx.normal_size() - reserved < writer->len) break;
+        reserved += writer->len;
+        Response res = {
+            .tag = Response::Putstr,
+            .putstr = {.success = false, .retry = true, .bytes_written = 0}};
+        Reply(writer->tid, (char*)&res, sizeof(res));
+        writers.pop_front();
     }
 }
 
-inline static void check_channel(int channel) {
-    if (channel == COM1 || channel == COM2) return;
+inline static void check_channel(int channel, const bool serves[2]) {
+    if ((channel == COM1 || channel == COM2) && serves[channel]) return;
     panic("bad channel %d", channel);
 }
 
-void Server() {
-    set_up_uarts();
+static void ServerImpl(const char* server_id,
+                       bool serve_com1,
+                       bool serve_com2) {
+    const bool serves[2] = {serve_com1, serve_com2};
 
-    debug("Uart::Server: started");
+    if (serve_com1) set_up_com1();
+    if (serve_com2) set_up_com2();
 
-    Create(INT_MAX, COM1Notifier);
-    Create(INT_MAX, COM2Notifier);
+    debug("Uart::Server: started (%s)", server_id);
 
-    RegisterAs(SERVER_ID);
-    int clock = WhoIs(Clock::SERVER_ID);
-    assert(clock >= 0);
+    if (serve_com1) Create(INT_MAX, COM1Notifier);
+    if (serve_com2) Create(INT_MAX, COM2Notifier);
+    if (serve_com1) Create(INT_MAX - 1, COM1CTSTimeoutCourier);
+
+    // RX interrupts stay enabled for the lifetime of the server, so that
+    // incoming bytes are buffered even when nobody is reading.
+    if (serve_com1) enable_rx_interrupts(COM1);
+    if (serve_com2) enable_rx_interrupts(COM2);
+
+    RegisterAs(server_id);
 
     CTSState com1_cts = {.tag = CTSState::ACTUALLY_CTS, .actually_cts = {}};
+    // set while the CTS timeout courier is blocked waiting to be armed
+    std::optional<int> cts_courier = std::nullopt;
     int tid;
     Request req;
     Response res;
     memset((char*)&res, 0, sizeof(res));
 
     // one for each channel
-    Iobuf tx_buffers[2] = {Iobuf(), Iobuf()};
-    std::optional<rx_blocked_task_t> rx_blocked_tids[2] = {std::nullopt};
-    std::optional<flush_blocked_task_t> flush_blocked_tids[2] = {std::nullopt};
+    TxLanes tx_lanes[2] = {TxLanes(), TxLanes()};
+    Rxbuf rx_buffers[2] = {Rxbuf(), Rxbuf()};
+    RxReaders rx_readers[2] = {RxReaders(), RxReaders()};
+    size_t rx_dropped[2] = {0, 0};
+    TxWriters tx_writers[2] = {TxWriters(), TxWriters()};
+    size_t tx_reserved[2] = {0, 0};
+    FlushWaiters flush_waiters[2] = {FlushWaiters(), FlushWaiters()};
 
     while (true) {
+        // Arm the CTS timeout courier whenever COM1 starts waiting for CTS to
+        // drop. It's only ever armed once at a time, no matter how many bytes
+        // are sent while it's out.
+        if (cts_courier.has_value() &&
+            com1_cts.tag == CTSState::WAITING_FOR_DOWN) {
+            int ticks = COM1_WAITING_FOR_DOWN_TIMEOUT;
+            Reply(cts_courier.value(), (char*)&ticks, sizeof(ticks));
+            cts_courier = std::nullopt;
+        }
+
         int reqlen = Receive(&tid, (char*)&req, sizeof(req));
-        if (reqlen <= (int)sizeof(req.tag))
-            panic("Uart::Server: bad request length %d", reqlen);
+        if (!request_is_valid(req, reqlen))
+            panic("Uart::Server: bad request length %d (tag=%d, tid=%d)",
+                  reqlen, (int)req.tag, tid);
         switch (req.tag) {
             case Request::Notify: {
                 // Reply to the notifier so it can start to AwaitEvent()
@@ -296,10 +596,8 @@ void Server() {
                 }
 
                 int channel = req.notify.channel;
-                check_channel(channel);
-                Iobuf& buf = tx_buffers[channel];
+                check_channel(channel, serves);
                 const volatile uint32_t* flags = flags_for(channel);
-                volatile char* data = data_for(channel);
 
                 debug("Server: received notify: channel=%d data=0x%lx", channel,
                       req.notify.data.raw);
@@ -321,175 +619,190 @@ void Server() {
                         }
                     }
 
-                    int bytes_written = 0;
-                    while (!buf.is_empty() &&
-                           clear_to_send(channel, com1_cts, clock)) {
-                        char c = buf.pop_front().value();
-                        if (channel == COM1) {
-                            enable_tx_interrupts(channel);
-                        }
-                        *data = (uint32_t)c;
-                        record_byte_sent(flush_blocked_tids[channel]);
-                        bytes_written++;
-                    }
-                    debug(
-                        "Server: Notify: received tx and wrote %d "
-                        "bytes, %u "
-                        "left in buffer",
-                        bytes_written, buf.size());
-
-                    if (!buf.is_empty()) {
-                        enable_tx_interrupts(channel);
-                    }
+                    write_tx(channel, tx_lanes[channel], com1_cts,
+                             flush_waiters[channel]);
+                    wake_tx_writers(tx_writers[channel], tx_lanes[channel],
+                                    TX_CAPACITY[channel], tx_reserved[channel]);
                 }
 
                 // RX
-                if (rx_blocked_tids[channel].has_value() &&
-                    (req.notify.data._.rx || req.notify.data._.rx_timeout)) {
-                    rx_blocked_task_t& blocked =
-                        rx_blocked_tids[channel].value();
-                    while (blocked.written < blocked.getn_res.getn.n &&
-                           !(*flags & RXFE_MASK)) {
-                        char c = *data;
-                        blocked.getn_res.getn.bytes[blocked.written++] = c;
-                    }
-
-                    if (blocked.written == blocked.getn_res.getn.n) {
-                        debug(
-                            "replying to getn after interrupt tid=%d "
-                            "channel=%d "
-                            "n=%u bytes[0]=%02x bytes=%-10s" ENDL,
-                            blocked.tid, channel, blocked.getn_res.getn.n,
-                            blocked.getn_res.getn.bytes[0],
-                            blocked.getn_res.getn.bytes);
-                        Reply(blocked.tid, (char*)&blocked.getn_res,
-                              sizeof(blocked.getn_res));
-                        rx_blocked_tids[channel] = std::nullopt;
-                    } else {
-                        enable_rx_interrupts(channel);
+                if (req.notify.data._.rx || req.notify.data._.rx_timeout) {
+                    size_t dropped = rx_dropped[channel];
+                    drain_rx_fifo(channel, rx_buffers[channel],
+                                  rx_dropped[channel]);
+                    if (rx_dropped[channel] != dropped) {
+                        debug("Uart::Server: RX buffer full for channel %d, "
+                              "%u bytes dropped so far",
+                              channel, rx_dropped[channel]);
                     }
+                    serve_rx_readers(rx_readers[channel], rx_buffers[channel]);
+                    enable_rx_interrupts(channel);
                 }
                 break;
             }
             case Request::Putstr: {
-                const int len = (int)req.putstr.len;
-                int i = 0;
+                const size_t len = req.putstr.len;
                 int channel = req.putstr.channel;
-                check_channel(channel);
-                char* msg = req.putstr.buf;
-
-                Iobuf& buf = tx_buffers[channel];
-                volatile char* data = data_for(channel);
-
-                if (buf.is_empty()) {
-                    assert(!flush_blocked_tids[channel].has_value());
-
-                    // try writing directly to the wire
-                    for (; i < len && clear_to_send(channel, com1_cts, clock);
-                         i++) {
-                        if (channel == COM1) enable_tx_interrupts(channel);
-                        *data = msg[i];
+                check_channel(channel, serves);
+                const char* msg = req.putstr.buf;
+
+                TxLanes& tx = tx_lanes[channel];
+                const size_t capacity = TX_CAPACITY[channel];
+                size_t& reserved = tx_reserved[channel];
+
+                // a write that can never be accepted is rejected outright,
+                // rather than parking the writer forever
+                const Response rejected = {
+                    .tag = Response::Putstr,
+                    .putstr = {
+                        .success = false, .retry = false, .bytes_written = 0}};
+
+                size_t accepted = 0;
+                if (req.putstr.lane == Lane::Urgent) {
+                    // Urgent frames are small and rare, so they're never
+                    // parked or split.
+                    if (!tx.push_frame(Lane::Urgent, msg, len)) {
+                        int ret = Reply(tid, (char*)&rejected,
+                                        sizeof(rejected));
+                        assert(ret >= 0);
+                        continue;
                     }
-
-                    if (i < len) {
-                        // we couldn't write the whole message, so buffer
-                        // the rest and enable interrupts.
-                        for (; i < len; i++) {
-                            auto err = buf.push_back(msg[i]);
-                            if (err == QueueErr::FULL) {
-                                panic(
-                                    "Uart::Server: output buffer full for "
-                                    "channel %d (trying to accept %d-byte "
-                                    "write from tid %d)",
-                                    channel, len, tid);
+                    accepted = len;
+                } else if (req.putstr.reserved) {
+                    assert(reserved >= len);
+                    reserved -= len;
+                    accepted = len;
+                } else {
+                    // parked writers get first dibs on any free space
+                    size_t available =
+                        tx_writers[channel].is_empty()
+                            ? capacity - tx.normal_size() - reserved
+                            : 0;
+                    switch (req.putstr.mode) {
+                        case PutstrMode::Block:
+                            if (len > capacity) {
+                                int ret = Reply(tid, (char*)&rejected,
+                                                sizeof(rejected));
+                                assert(ret >= 0);
+                                continue;
                             }
-                        }
+                            if (len > available) {
+                                auto err = tx_writers[channel].push_back(
+                                    {.tid = tid, .len = len});
+                                if (err == QueueErr::FULL) {
+                                    panic(
+                                        "Uart::Server: too many blocked "
+                                        "writers on channel %d",
+                                        channel);
+                                }
+                                continue;  // reply once there's space
+                            }
+                            accepted = len;
+                            break;
+                        case PutstrMode::Try:
+                            accepted = std::min(len, available);
+                            break;
+                    }
+                }
 
-                        enable_tx_interrupts(channel);
+                if (req.putstr.lane == Lane::Normal) {
+                    // a partial TryPutstr is only ever one frame
+                    const size_t num_frames =
+                        accepted == len ? req.putstr.num_frames : 0;
+                    if (num_frames == 0) {
+                        bool ok = tx.push_frame(Lane::Normal, msg, accepted);
+                        assert(ok);
                     }
-                } else {
-                    // buffer the entire message
-                    for (; i < len; i++) {
-                        auto err = buf.push_back(msg[i]);
-                        if (err == QueueErr::FULL) {
-                            panic(
-                                "Uart::Server: output buffer full for channel "
-                                "%d (trying to accept %d-byte write from tid "
-                                "%d)",
-                                channel, len, tid);
-                        }
+                    for (size_t i = 0; i < num_frames; i++) {
+                        const size_t frame_len = req.putstr.frame_lens[i];
+                        bool ok = tx.push_frame(Lane::Normal, msg, frame_len);
+                        assert(ok);
+                        msg += frame_len;
                     }
                 }
+                write_tx(channel, tx, com1_cts, flush_waiters[channel]);
 
                 res = {.tag = Response::Putstr,
-                       .putstr = {.success = true, .bytes_written = len}};
+                       .putstr = {.success = true,
+                                  .retry = false,
+                                  .bytes_written = (int)accepted}};
                 int ret = Reply(tid, (char*)&res, sizeof(res));
                 assert(ret >= 0);
                 break;
             }
+            case Request::CTSTimeout: {
+                cts_courier = tid;
+                int ticks = check_cts_timeout(com1_cts);
+                if (ticks == 0) {
+                    write_tx(COM1, tx_lanes[COM1], com1_cts,
+                             flush_waiters[COM1]);
+                    wake_tx_writers(tx_writers[COM1], tx_lanes[COM1],
+                                    TX_CAPACITY[COM1], tx_reserved[COM1]);
+                    ticks = check_cts_timeout(com1_cts);
+                }
+                if (ticks > 0) {
+                    Reply(tid, (char*)&ticks, sizeof(ticks));
+                    cts_courier = std::nullopt;
+                }
+                break;
+            }
             case Request::Getn: {
                 int channel = req.getn.channel;
+                check_channel(channel, serves);
                 size_t n = req.getn.n;
-                assert(n > 0);
-                assert(n <= MAX_GETN_SIZE);
-                const volatile uint32_t* flags = flags_for(channel);
-                volatile char* data = data_for(channel);
-
-                res = {.tag = Response::Getn,
-                       .getn = {.success = false, .n = n, .bytes = {}}};
+                if (n == 0 || n > RXBUF_SIZE)
+                    panic("Uart::Server: bad Getn size %u (tid %d)", n, tid);
 
                 debug("received Getn from tid %d channel=%d n=%u" ENDL, tid,
                       channel, n);
-                if (rx_blocked_tids[channel].has_value()) {
-                    panic(
-                        "multiple tids trying to read from channel %d (%d "
-                        "and "
-                        "%d)",
-                        channel, rx_blocked_tids[channel].value().tid, tid);
-                    Reply(tid, (char*)&res, sizeof(res));
-                    break;
-                }
 
-                res.getn.success = true;
-                rx_blocked_tids[channel] = {
-                    .tid = tid, .written = 0, .getn_res = res};
-                rx_blocked_task_t& blocked = rx_blocked_tids[channel].value();
-
-                while (!(*flags & RXFE_MASK) && blocked.written < n) {
-                    char c = (char)*data;
-                    blocked.getn_res.getn.bytes[blocked.written++] = c;
+                RxReaders& readers = rx_readers[channel];
+                auto err = readers.push_back({.tid = tid, .n = n});
+                if (err == QueueErr::FULL) {
+                    panic("Uart::Server: too many readers on channel %d",
+                          channel);
                 }
 
-                if (blocked.written == n) {
-                    debug(
-                        "replying to getn immediately tid=%d channel=%d "
-                        "n=%u bytes[0]=%02x bytes=%-10s" ENDL,
-                        tid, channel, n, blocked.getn_res.getn.bytes[0],
-                        blocked.getn_res.getn.bytes);
-                    Reply(tid, (char*)&blocked.getn_res,
-                          sizeof(blocked.getn_res));
-                    rx_blocked_tids[channel] = std::nullopt;
-                    break;
+                drain_rx_fifo(channel, rx_buffers[channel],
+                              rx_dropped[channel]);
+                serve_rx_readers(readers, rx_buffers[channel]);
+                break;
+            }
+            case Request::TryGetn: {
+                int channel = req.try_getn.channel;
+                check_channel(channel, serves);
+                Rxbuf& rx = rx_buffers[channel];
+
+                // Bytes are owned by blocked readers first, so TryGetn only
+                // reads when nobody is waiting.
+                size_t n = 0;
+                if (rx_readers[channel].is_empty()) {
+                    drain_rx_fifo(channel, rx, rx_dropped[channel]);
+                    n = std::min(req.try_getn.n, rx.size());
                 }
 
-                enable_rx_interrupts(channel);
+                char bytes[n + 1];
+                for (size_t i = 0; i < n; i++) {
+                    bytes[i] = rx.pop_front().value();
+                }
+                Reply(tid, bytes, (int)n);
                 break;
             }
             case Request::Drain: {
                 int channel = req.drain.channel;
+                check_channel(channel, serves);
                 const volatile uint32_t* flags = flags_for(channel);
                 volatile char* data = data_for(channel);
 
                 while (!(*flags & RXFE_MASK)) {
                     *data;
                 }
+                rx_buffers[channel].clear();
 
-                // If any task was blocked on a Getn with an incomplete
-                // response, clear the response.
-                if (rx_blocked_tids[channel].has_value()) {
-                    rx_blocked_task_t& blocked =
-                        rx_blocked_tids[channel].value();
-                    blocked.written = 0;
+                // whatever the readers were waiting for has just been thrown
+                // away, so let them know rather than leaving them blocked.
+                while (auto reader = rx_readers[channel].pop_front()) {
+                    Reply(reader.value().tid, nullptr, 0);
                 }
 
                 Reply(tid, nullptr, 0);
@@ -497,86 +810,145 @@ void Server() {
             }
             case Request::Flush: {
                 int channel = req.flush.channel;
-                check_channel(channel);
-                Iobuf& buf = tx_buffers[channel];
-                if (buf.is_empty()) {
+                check_channel(channel, serves);
+                const TxLanes& tx = tx_lanes[channel];
+                if (tx.is_empty()) {
                     Reply(tid, nullptr, 0);
                     break;
                 }
-                if (flush_blocked_tids[channel].has_value()) {
-                    panic("concurrent Flush unsupported (channel=%d)", channel);
+                auto err = flush_waiters[channel].push_back(
+                    {.tid = tid, .until = {tx.queued[0], tx.queued[1]}});
+                if (err == QueueErr::FULL) {
+                    panic("Uart::Server: too many Flush waiters on channel %d",
+                          channel);
                 }
-                flush_blocked_tids[channel] = {.tid = tid,
-                                               .bytes_remaining = buf.size()};
 
                 break;
             }
         }
     }
-}  // namespace Uart
+}
+
+void Server() { ServerImpl(SERVER_ID, true, true); }
+void COM1Server() { ServerImpl(COM1_SERVER_ID, true, false); }
+void COM2Server() { ServerImpl(COM2_SERVER_ID, false, true); }
 
 int Getc(int tid, int channel) {
-    Request req = {.tag = Request::Getn, .getn = {.channel = channel, .n = 1}};
-    Response res;
-    int n = Send(tid, (char*)&req, sizeof(req), (char*)&res, sizeof(res));
-    assert(n == sizeof(res));
-    assert(res.tag == Response::Getn);
-    if (res.getn.success) {
-        return (int)res.getn.bytes[0];
-    }
-    return -1;
+    char c;
+    if (Getn(tid, channel, 1, &c) != 1) return -1;
+    return (int)c;
 }
 
 int Getn(int tid, int channel, size_t n, char* buf) {
+    assert(n <= RXBUF_SIZE);
     Request req = {.tag = Request::Getn, .getn = {.channel = channel, .n = n}};
-    Response res;
-    int ret = Send(tid, (char*)&req, sizeof(req), (char*)&res, sizeof(res));
-    assert(ret == sizeof(res));
-    assert(res.tag == Response::Getn);
-    if (res.getn.success) {
-        memcpy(buf, res.getn.bytes, n);
-        return (int)n;
-    }
-    return -1;
+    int ret = send_request(tid, req, buf, (int)n);
+    if (ret != (int)n) return -1;
+    return ret;
 }
 
-static int send_putstr(int tid, const Request& req) {
+int TryGetn(int tid, int channel, size_t n, char* buf) {
+    Request req = {.tag = Request::TryGetn,
+                   .try_getn = {.channel = channel, .n = n}};
+    return send_request(tid, req, buf, (int)n);
+}
+
+static int send_putstr(int tid, Request& req) {
     Response res;
-    int size = (int)putstr_request_size(req);
-    int n = Send(tid, (char*)&req, size, (char*)&res, sizeof(res));
-    assert(n == sizeof(res));
-    assert(res.tag == Response::Putstr);
+    while (true) {
+        int n = send_request(tid, req, (char*)&res, sizeof(res));
+        assert(n == sizeof(res));
+        assert(res.tag == Response::Putstr);
+        if (!res.putstr.retry) break;
+        req.putstr.reserved = true;
+    }
     if (res.putstr.success) return res.putstr.bytes_written;
     return -1;
 }
 
-int Putstr(int tid, int channel, const char* msg) {
-    size_t len = strlen(msg);
-    assert(len < IOBUF_SIZE);
+static int putn_with_mode(int tid,
+                          int channel,
+                          const char* buf,
+                          size_t len,
+                          PutstrMode mode,
+                          Lane lane) {
+    if (len > IOBUF_SIZE) return -1;
     // `req` can contain a buffer up to length IOBUF_SIZE, but we only copy
-    // strlen(msg) bytes into the request.
+    // `len` bytes into the request.
     Request req = {.tag = Request::Putstr,
-                   .putstr = {.channel = channel, .len = len, .buf = {}}};
-    memcpy(req.putstr.buf, msg, len);
+                   .putstr = {.channel = channel,
+                              .mode = mode,
+                              .lane = lane,
+                              .reserved = false,
+                              .len = len,
+                              .num_frames = 0,
+                              .frame_lens = {},
+                              .buf = {}}};
+    memcpy(req.putstr.buf, buf, len);
     return send_putstr(tid, req);
 }
 
-int Putc(int tid, int channel, char c) {
+int Putstr(int tid, int channel, const char* msg) {
+    return putn_with_mode(tid, channel, msg, strlen(msg), PutstrMode::Block,
+                          Lane::Normal);
+}
+
+int TryPutstr(int tid, int channel, const char* msg) {
+    return putn_with_mode(tid, channel, msg, strlen(msg), PutstrMode::Try,
+                          Lane::Normal);
+}
+
+int Putn(int tid, int channel, const char* buf, size_t len, Lane lane) {
+    return putn_with_mode(tid, channel, buf, len, PutstrMode::Block, lane);
+}
+
+int PutFrames(int tid,
+              int channel,
+              const char* buf,
+              const uint8_t frame_lens[],
+              size_t num_frames) {
+    if (num_frames == 0) return 0;
+    if (num_frames > MAX_PUT_FRAMES) return -1;
+    size_t len = 0;
+    for (size_t i = 0; i < num_frames; i++) len += frame_lens[i];
+    if (len > IOBUF_SIZE) return -1;
     Request req = {.tag = Request::Putstr,
-                   .putstr = {.channel = channel, .len = 1, .buf = {}}};
-    req.putstr.buf[0] = c;
+                   .putstr = {.channel = channel,
+                              .mode = PutstrMode::Block,
+                              .lane = Lane::Normal,
+                              .reserved = false,
+                              .len = len,
+                              .num_frames = num_frames,
+                              .frame_lens = {},
+                              .buf = {}}};
+    memcpy(req.putstr.frame_lens, frame_lens, num_frames);
+    memcpy(req.putstr.buf, buf, len);
     return send_putstr(tid, req);
 }
 
+int Putc(int tid, int channel, char c) {
+    return putn_with_mode(tid, channel, &c, 1, PutstrMode::Block,
+                          Lane::Normal);
+}
+
 int Printf(int tid, int channel, const char* format, ...) {
     Request req = {.tag = Request::Putstr,
-                   .putstr = {.channel = channel, .len = 0, .buf = {}}};
+                   .putstr = {.channel = channel,
+                              .mode = PutstrMode::Block,
+                              .lane = Lane::Normal,
+                              .reserved = false,
+                              .len = 0,
+                              .num_frames = 0,
+                              .frame_lens = {},
+                              .buf = {}}};
 
     va_list va;
     va_start(va, format);
     int len = vsnprintf(req.putstr.buf, sizeof(req.putstr.buf), format, va);
     assert(len >= 0);
     va_end(va);
+    // don't send a truncated message
+    if ((size_t)len >= sizeof(req.putstr.buf)) return -1;
 
     req.putstr.len = (size_t)len;
 
@@ -610,12 +982,12 @@ void Getline(int tid, int channel, char* line, size_t len) {
 
 void Drain(int tid, int channel) {
     Request req = {.tag = Request::Drain, .drain = {.channel = channel}};
-    Send(tid, (char*)&req, sizeof(req), nullptr, 0);
+    send_request(tid, req, nullptr, 0);
 }
 
 void Flush(int tid, int channel) {
     Request req = {.tag = Request::Flush, .flush = {.channel = channel}};
-    Send(tid, (char*)&req, sizeof(req), nullptr, 0);
+    send_request(tid, req, nullptr, 0);
 }
 
 }  // namespace Uart
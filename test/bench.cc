@@ -0,0 +1,128 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+#include "common/sensor_bitmap.h"
+#include "src/assignments/t2/route_planner.h"
+#include "src/assignments/t2/track_graph.h"
+
+// The bit-at-a-time decoder that SensorBitmap replaced, kept around as a
+// baseline.
+static size_t decode_shift_loop(const char bytes[SensorBitmap::RAW_LEN],
+                                sensor_t* out) {
+    size_t n = 0;
+    for (size_t bi = 0; bi < SensorBitmap::RAW_LEN; bi++) {
+        char byte = bytes[bi];
+        for (size_t i = 1; i <= 8; i++) {
+            if ((byte >> (8 - i)) & 0x01) {
+                out[n++] = {.group = (char)((int)'A' + (bi / 2)),
+                            .idx = (uint8_t)(i + (8 * (bi % 2)))};
+            }
+        }
+    }
+    return n;
+}
+
+static size_t decode_bitmap(const char bytes[SensorBitmap::RAW_LEN],
+                            sensor_t* out) {
+    return SensorBitmap::from_raw(bytes).extract(out, 80);
+}
+
+template <class F>
+static void bench(const char* name,
+                  F decode,
+                  const char (*dumps)[SensorBitmap::RAW_LEN],
+                  size_t num_dumps) {
+    constexpr size_t ROUNDS = 200;
+    sensor_t out[80];
+    size_t total = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < ROUNDS; r++) {
+        for (size_t i = 0; i < num_dumps; i++) total += decode(dumps[i], out);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double ns =
+        (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+            .count();
+    std::cout << name << ": " << ns / (double)(ROUNDS * num_dumps)
+              << " ns/dump (" << total << " sensors)" << std::endl;
+}
+
+static sensor_t nth_sensor(int i) {
+    return {.group = (char)('A' + i / 16), .idx = (uint8_t)(i % 16 + 1)};
+}
+
+// Six trains with fixed destinations re-plan every time another train grabs
+// or drops a short stretch of track, which is how the track oracle uses its
+// planners. `use_planner` picks between a RoutePlanner per train, and a fresh
+// TrackGraph::route every time.
+static void bench_routing(const char* name, bool use_planner) {
+    constexpr int NUM_TRAINS = 6;
+    constexpr int EVENTS = 5000;
+    constexpr uint8_t OTHER = NUM_TRAINS + 1;
+    static TrackGraph track(Marklin::Track::A);
+    static RoutePlanner planners[NUM_TRAINS];
+
+    srand(3);
+    int start[NUM_TRAINS];
+    int goal[NUM_TRAINS];
+    for (int t = 0; t < NUM_TRAINS; t++) {
+        start[t] = rand() % 80;
+        goal[t] = rand() % 80;
+    }
+    track.release_all(OTHER);
+
+    double ns = 0;
+    size_t total = 0;
+    for (int ev = 0; ev < EVENTS; ev++) {
+        if (ev % 2 == 0) {
+            (void)track.reserve_footprint(OTHER, {nth_sensor(rand() % 80), 0},
+                                          0, 50);
+        } else {
+            track.release_all(OTHER);
+        }
+        if (ev % 200 == 0) {
+            for (int t = 0; t < NUM_TRAINS; t++) goal[t] = rand() % 80;
+        }
+
+        for (int t = 0; t < NUM_TRAINS; t++) {
+            const track_node* path[TRACK_MAX];
+            size_t distance = 0;
+            const uint8_t train = (uint8_t)(t + 1);
+            auto before = std::chrono::steady_clock::now();
+            const int len =
+                use_planner
+                    ? planners[t].route(track, nth_sensor(start[t]),
+                                        nth_sensor(goal[t]), path, TRACK_MAX,
+                                        distance, train)
+                    : track.route(nth_sensor(start[t]), nth_sensor(goal[t]),
+                                  path, TRACK_MAX, distance, train);
+            auto after = std::chrono::steady_clock::now();
+            ns += (double)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      after - before)
+                      .count();
+            if (len > 0) total += distance;
+        }
+    }
+    std::cout << name << ": " << ns / (EVENTS * NUM_TRAINS)
+              << " ns/route (" << total << " mm)" << std::endl;
+}
+
+int main() {
+    // Most real dumps have zero or one sensor set, so that's what's used here.
+    constexpr size_t NUM_DUMPS = 10000;
+    static char dumps[NUM_DUMPS][SensorBitmap::RAW_LEN] = {};
+    srand(42);
+    for (auto& dump : dumps) {
+        if (rand() % 4 == 0) continue;
+        dump[rand() % SensorBitmap::RAW_LEN] = (char)(1 << (rand() % 8));
+    }
+
+    bench("shift loop", decode_shift_loop, dumps, NUM_DUMPS);
+    bench("bitmap    ", decode_bitmap, dumps, NUM_DUMPS);
+
+    bench_routing("A*      ", false);
+    bench_routing("planner ", true);
+}
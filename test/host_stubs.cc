@@ -0,0 +1,22 @@
+// Host stand-ins for the syscalls and busy-wait IO behind user/debug.h's
+// assert() and panic(), so that target code can run in the unit tests.
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+
+#include "common/bwio.h"
+#include "user/syscalls.h"
+
+int MyTid() { return 0; }
+
+void Shutdown() { abort(); }
+
+int bwprintf(int channel, const char* format, ...) {
+    (void)channel;
+    va_list va;
+    va_start(va, format);
+    int n = vfprintf(stderr, format, va);
+    va_end(va);
+    return n;
+}
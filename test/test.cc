@@ -5,6 +5,9 @@
 #include "common/opt_array.h"
 #include "common/priority_queue.h"
 #include "common/queue.h"
+#include "common/sensor_bitmap.h"
+#include "src/assignments/t2/route_planner.h"
+#include "src/assignments/t2/track_graph.h"
 
 void test_queue() {
     Queue<int, 10> q;
@@ -80,6 +83,15 @@ void test_priority_queue() {
     pq.push(1, 3);
     assert(pq.pop() == 2);
     assert(pq.pop() == 1);
+
+    // priorities wider than an int
+    PriorityQueue<int, 4, int64_t> wide;
+    wide.push(0, (int64_t)1 << 40);
+    wide.push(1, ((int64_t)1 << 40) + 1);
+    wide.push(2, -((int64_t)1 << 40));
+    assert(wide.pop() == 1);
+    assert(wide.pop() == 0);
+    assert(wide.pop() == 2);
 }
 
 void test_opt_array() {
@@ -109,10 +121,277 @@ void test_opt_array() {
     assert(!arr.get(0).has_value());
 }
 
+void test_sensor_bitmap() {
+    char raw[SensorBitmap::RAW_LEN] = {0};
+    assert(SensorBitmap::from_raw(raw).is_empty());
+
+    raw[0] = (char)0x80;  // A1
+    raw[1] = (char)0x01;  // A16
+    raw[5] = (char)0x44;  // C10, C14
+    raw[8] = (char)0x80;  // E1
+    SensorBitmap b = SensorBitmap::from_raw(raw);
+
+    assert(!b.is_empty());
+    assert(b.is_set({'A', 1}));
+    assert(b.is_set({'A', 16}));
+    assert(!b.is_set({'A', 2}));
+    assert(b.is_set({'C', 10}));
+    assert(b.is_set({'C', 14}));
+    assert(b.is_set({'E', 1}));
+    assert(!b.is_set({'F', 1}));
+
+    sensor_t out[80];
+    assert(b.extract(out, 80) == 5);
+    assert(out[0] == (sensor_t{'A', 1}));
+    assert(out[1] == (sensor_t{'A', 16}));
+    assert(out[2] == (sensor_t{'C', 10}));
+    assert(out[3] == (sensor_t{'C', 14}));
+    assert(out[4] == (sensor_t{'E', 1}));
+
+    assert(b.extract(out, 2) == 2);
+    assert(out[1] == (sensor_t{'A', 16}));
+
+    // A1 stays down, A16 is released, and B3 is newly triggered
+    char raw2[SensorBitmap::RAW_LEN];
+    for (size_t i = 0; i < SensorBitmap::RAW_LEN; i++) raw2[i] = raw[i];
+    raw2[1] = 0;
+    raw2[2] = (char)0x20;
+    SensorBitmap rising = SensorBitmap::from_raw(raw2).rising_edges(b);
+    assert(rising.extract(out, 80) == 1);
+    assert(out[0] == (sensor_t{'B', 3}));
+
+    assert(rising.pop_front() == (sensor_t{'B', 3}));
+    assert(rising.pop_front() == std::nullopt);
+    assert(rising.is_empty());
+
+    // every sensor is decoded to the right place
+    for (size_t bi = 0; bi < SensorBitmap::RAW_LEN; bi++) {
+        for (size_t bit = 0; bit < 8; bit++) {
+            char one[SensorBitmap::RAW_LEN] = {0};
+            one[bi] = (char)(0x80 >> bit);
+            assert(SensorBitmap::from_raw(one).extract(out, 80) == 1);
+            assert(out[0].group == (char)('A' + bi / 2));
+            assert(out[0].idx == 8 * (bi % 2) + bit + 1);
+        }
+    }
+}
+
+static sensor_t nth_sensor(size_t i) {
+    return {.group = (char)('A' + i / 16), .idx = (uint8_t)(i % 16 + 1)};
+}
+
+// The distance travelled along a route, plus the penalty for its reversals.
+static int route_cost(const TrackGraph& track,
+                      const track_node* const path[],
+                      int len,
+                      size_t distance) {
+    int cost = (int)distance;
+    for (int i = 0; i + 1 < len; i++) {
+        if (track.index_of(path[i + 1]) == path[i]->reverse)
+            cost += DEFAULT_REVERSAL_PENALTY_MM;
+    }
+    return cost;
+}
+
+// Checks the planner's route against a fresh TrackGraph::route, and returns
+// its cost (or -1 if there's no route).
+static int check_planner_route(TrackGraph& track,
+                               RoutePlanner& planner,
+                               const sensor_t& start,
+                               const sensor_t& goal,
+                               uint8_t train) {
+    const track_node* expected[TRACK_MAX];
+    const track_node* actual[TRACK_MAX];
+    size_t expected_distance = 0;
+    size_t actual_distance = 0;
+    const int expected_len = track.route(start, goal, expected, TRACK_MAX,
+                                         expected_distance, train);
+    const int actual_len = planner.route(track, start, goal, actual, TRACK_MAX,
+                                         actual_distance, train);
+    assert((expected_len < 0) == (actual_len < 0));
+    if (actual_len <= 0) return actual_len < 0 ? -1 : 0;
+
+    const int cost = route_cost(track, actual, actual_len, actual_distance);
+    assert(cost ==
+           route_cost(track, expected, expected_len, expected_distance));
+    assert(actual[0] == expected[0]);
+    assert(actual[actual_len - 1] == expected[expected_len - 1]);
+
+    // The route can actually be taken (and is clear of other trains). This
+    // is checked on a copy, so that the planner doesn't see it as a change.
+    static TrackGraph scratch = track;
+    scratch = track;
+    assert(scratch.reserve_path(train, actual, (size_t)actual_len));
+    return cost;
+}
+
+void test_route_planner() {
+    static TrackGraph track(Marklin::Track::A);
+    static RoutePlanner planner;
+    constexpr uint8_t TRAIN = 1;
+    constexpr uint8_t OTHER = 2;
+    const sensor_t goal = {'C', 10};
+
+    size_t detours = 0;
+    for (size_t i = 0; i < 80; i += 3) {
+        const sensor_t start = nth_sensor(i);
+        const int clear =
+            check_planner_route(track, planner, start, goal, TRAIN);
+        if (clear <= 0) continue;
+
+        // another train parks on a sensor halfway along the route...
+        const track_node* path[TRACK_MAX];
+        size_t distance = 0;
+        const int len = planner.route(track, start, goal, path, TRACK_MAX,
+                                      distance, TRAIN);
+        const track_node* blocker = nullptr;
+        for (int k = len / 2; k + 1 < len && blocker == nullptr; k++) {
+            if (path[k]->type == NODE_SENSOR) blocker = path[k];
+        }
+        if (blocker == nullptr) continue;
+        (void)track.reserve_footprint(
+            OTHER, {nth_sensor((size_t)blocker->num), 0}, 100, 100);
+
+        // ...so the planner has to repair its search to route around it...
+        const int blocked =
+            check_planner_route(track, planner, start, goal, TRAIN);
+        assert(blocked == -1 || blocked >= clear);
+        if (blocked != clear) detours++;
+
+        // ...and repair it again once the track is free
+        track.release_all(OTHER);
+        assert(check_planner_route(track, planner, start, goal, TRAIN) ==
+               clear);
+    }
+    assert(detours > 0);
+
+    // a long reservation changes the cost of a great many nodes at once, all
+    // of which have to be repaired
+    for (size_t i = 1; i < 80; i += 5) {
+        const sensor_t start = nth_sensor(i);
+        const int clear =
+            check_planner_route(track, planner, start, goal, TRAIN);
+        (void)track.reserve_footprint(OTHER, {nth_sensor((i * 7) % 80), 0},
+                                      300, 4000);
+        (void)check_planner_route(track, planner, start, goal, TRAIN);
+        track.release_all(OTHER);
+        assert(check_planner_route(track, planner, start, goal, TRAIN) ==
+               clear);
+    }
+
+    // routes which mustn't reverse
+    for (size_t i = 0; i < 80; i += 7) {
+        const track_node* path[TRACK_MAX];
+        size_t distance = 0;
+        const int len = planner.route(track, nth_sensor(i), goal, path,
+                                      TRACK_MAX, distance, TRAIN, NO_REVERSALS);
+        if (len <= 0) continue;
+        assert(route_cost(track, path, len, distance) == (int)distance);
+    }
+}
+
+void test_reservations() {
+    static TrackGraph track(Marklin::Track::A);
+    constexpr uint8_t TRAIN = 1;
+    constexpr uint8_t OTHER = 2;
+    constexpr uint8_t THIRD = 3;
+    const Marklin::track_pos_t pos = {{'C', 10}, 0};
+
+    // a route that runs into `pos`, ignoring reservations
+    const track_node* path[TRACK_MAX];
+    size_t distance = 0;
+    sensor_t from = {};
+    int len = -1;
+    for (size_t i = 0; i < 80 && len < 4; i++) {
+        from = nth_sensor(i);
+        len = track.route(from, pos.sensor, path, TRACK_MAX, distance, 0,
+                          NO_REVERSALS);
+    }
+    assert(len >= 4);
+
+    // Track held by one train can't be reserved by another, and a path that
+    // runs into it is rejected without reserving any of it...
+    assert(track.reserve_footprint(TRAIN, pos, 300, 500));
+    assert(!track.reserve_footprint(OTHER, pos, 100, 0));
+    track.release_all(OTHER);
+    assert(!track.reserve_path(OTHER, path, (size_t)len));
+    track.release_all(TRAIN);
+    assert(track.reserve_path(THIRD, path, (size_t)len));
+    track.release_all(THIRD);
+
+    // ...while a route planned for the other train steers clear of it
+    assert(track.reserve_footprint(TRAIN, pos, 300, 500));
+    len = track.route(from, pos.sensor, path, TRACK_MAX, distance, OTHER);
+    if (len > 0) assert(track.reserve_path(OTHER, path, (size_t)len));
+    track.release_all(OTHER);
+    track.release_all(TRAIN);
+
+    // Releasing everything, and then re-reserving the footprint (as the
+    // oracle does once a train has arrived) keeps the track under the train,
+    // but frees the rest of its route.
+    len = track.route(pos.sensor, {'E', 8}, path, TRACK_MAX, distance, TRAIN,
+                      NO_REVERSALS);
+    assert(len >= 2 && distance > 1000);
+    assert(track.reserve_path(TRAIN, path, (size_t)len));
+    assert(track.reserve_footprint(TRAIN, pos, 300, 0));
+    track.release_all(TRAIN);
+    assert(track.reserve_footprint(TRAIN, pos, 300, 0));
+    assert(!track.reserve_footprint(OTHER, pos, 100, 0));
+    track.release_all(OTHER);
+    assert(track.reserve_path(OTHER, path + len - 2, 2));
+    track.release_all(OTHER);
+    track.release_all(TRAIN);
+
+    // A train that has come through a merge releases the leg it came in on,
+    // even if the switch (seen from the other side) points at the other leg.
+    size_t merges = 0;
+    for (size_t b = 0; b < TRACK_MAX; b++) {
+        const track_node& branch = track.node(b);
+        if (branch.type != NODE_BRANCH) continue;
+        const track_node& merge = track.node(branch.reverse);
+        for (size_t leg = 0; leg < 2; leg++) {
+            const track_node* walk[TRACK_MAX];
+            size_t walk_len = 0;
+            walk[walk_len++] = &track.node(
+                track.node(branch.edge[leg].dest).reverse);
+            walk[walk_len++] = &merge;
+
+            // follow the track from the merge to the next sensor
+            const track_node* n = &merge;
+            int merge_to_sensor_mm = 0;
+            do {
+                if (n->type == NODE_EXIT) break;
+                merge_to_sensor_mm += n->edge[DIR_AHEAD].dist;
+                n = &track.node(n->edge[DIR_AHEAD].dest);
+                walk[walk_len++] = n;
+            } while (n->type != NODE_SENSOR && walk_len < TRACK_MAX);
+            if (n->type != NODE_SENSOR || merge_to_sensor_mm <= 10) continue;
+
+            // the switch points at the other leg
+            Marklin::BranchMask branches;
+            branches.set((uint8_t)branch.num,
+                         leg == DIR_STRAIGHT ? Marklin::BranchDir::Curved
+                                             : Marklin::BranchDir::Straight);
+            track.set_branches(branches);
+
+            assert(track.reserve_path(TRAIN, walk, walk_len));
+            track.release_behind(TRAIN, {nth_sensor((size_t)n->num), 0}, 10);
+            assert(track.reserve_path(OTHER, walk, 2));
+            track.release_all(OTHER);
+            track.release_all(TRAIN);
+            merges++;
+        }
+    }
+    assert(merges > 0);
+}
+
 int main() {
     test_queue();
     test_priority_queue();
     test_opt_array();
+    test_sensor_bitmap();
+    test_route_planner();
+    test_reservations();
 
     std::cout << "unit tests passed" << std::endl;
 }